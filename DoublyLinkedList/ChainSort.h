@@ -0,0 +1,88 @@
+#ifndef CHAINSORT_H
+#define CHAINSORT_H
+
+#include <cstdint>
+
+// a Chain Sort sorts a null-terminated chain of linked nodes by rewriting
+// the link from each node to the next, so no node is moved or copied and
+// nothing is allocated; it is the merge sort shared by DoublyLinkedList
+// and IntrusiveList;
+// `Links` says how to reach the links from a node to the next and the
+// previous ones: it has static member functions `Node*& next(Node* node)`
+// and `Node*& prev(Node* node)`; the links back are never read, only set
+// for the sorted chain by sort();
+// `less(a, b)` returns true if node `a` sorts before node `b`; nodes that
+// compare equal keep their order
+template <typename Node, typename Links>
+class ChainSort {
+
+public:
+
+    // no Chain Sort objects are ever made; it only groups the functions
+    ChainSort(void) = delete;
+
+    // sort a chain with a bottom-up natural merge sort; runs that are
+    // already in order are found first (strictly descending runs are
+    // reversed as they are found), and are merged through a binary counter
+    // of pending chains while they fit in the cache; longer chains are
+    // merged WAY_COUNT at a time, fetching the next node of every chain
+    // ahead of time, so that a pass over nodes scattered in memory waits
+    // for many of them at once rather than one after another; every node
+    // but the first is linked back to the node before it as the last merge
+    // links it, rather than in another walk over the scattered nodes;
+    // returns the first node of the sorted chain and stores its last node
+    // in `last`
+    // see: https://en.wikipedia.org/Merge_sort
+    template <typename Less>
+    static Node* sort(Node* first, Node*& last, Less& less);
+
+    // merge two sorted chains given their first and last nodes, with the
+    // nodes of `a` first on ties; two chains that are already in order are
+    // joined in O(1); returns the first node of the merged chain and stores
+    // its last node in `last`
+    template <typename Less>
+    static Node* merge(Node* a, Node* aLast, Node* b, Node* bLast, Node*& last,
+                       Less& less);
+
+private:
+
+    // chains of nodes taking CACHE_BYTES or more are merged WAY_COUNT at
+    // a time, in up to WAY_LEVELS rounds
+    static const intmax_t CACHE_BYTES{1 << 20};
+    static const int WAY_COUNT{16};
+    static const int WAY_LEVELS{16};
+    static_assert((WAY_COUNT & (WAY_COUNT - 1)) == 0, "WAY_COUNT must be a power of two");
+
+    // merge `count` sorted chains, no more than WAY_COUNT, given their
+    // first and last nodes in list order, with the nodes of earlier chains
+    // first on ties; if `linkBack` is true, every node but the first is
+    // also linked back to the node before it; returns the first node of
+    // the merged chain and stores its last node in `last`
+    template <typename Less>
+    static Node* mergeMany(Node** firsts, Node** lasts, int count, bool linkBack,
+                           Node*& last, Less& less);
+
+    // merge the chains in the first `binsUsed` bins with the supplied
+    // chain, which holds the latest nodes and may be empty, and empty the
+    // bins; returns the first node of the merged chain and stores its last
+    // node in `last`
+    template <typename Less>
+    static Node* mergeBins(Node** binFirst, Node** binLast, int binsUsed, Node* first,
+                           Node*& last, Less& less);
+
+    // link every node of the chain that starts at `node` back to the node
+    // before it, with `prevNode` before `node`
+    static void relinkPrev(Node* node, Node* prevNode);
+
+    // cut the run that starts at `node` off of the chain and return its
+    // first node, storing its last node in `last` and its number of nodes
+    // in `length`; a strictly descending run is reversed as it is cut off;
+    // `node` is moved to the first node after the run
+    template <typename Less>
+    static Node* takeRun(Node*& node, Node*& last, intmax_t& length, Less& less);
+};
+
+// the definitions of the template's member functions
+#include "ChainSort.tpp"
+
+#endif
@@ -0,0 +1,364 @@
+template <typename Node, typename Links>
+template <typename Less>
+Node* ChainSort<Node, Links>::sort(Node* first, Node*& last, Less& less) {
+
+    // pending sorted chains waiting to be merged; like the digits of a
+    // binary counter, bin `i` is either empty or holds a chain that was
+    // made by merging 2^i runs, so small chains are merged while their
+    // nodes are still in the cache
+    const int BIN_COUNT{64};
+    Node* binFirst[BIN_COUNT] = {};
+    Node* binLast[BIN_COUNT] = {};
+    intmax_t binLength[BIN_COUNT] = {};
+
+    // number of bins that have been used so far
+    int binsUsed = 0;
+
+    // a chain that reaches this many nodes no longer fits in the cache; it
+    // is taken out of the bins and waits in a level to be merged WAY_COUNT
+    // at a time instead; like the digits of a counter in base WAY_COUNT,
+    // level `j` holds fewer than WAY_COUNT chains, in list order
+    const intmax_t bigLength = CACHE_BYTES / static_cast<intmax_t>(sizeof(Node));
+    Node* wayFirst[WAY_LEVELS][WAY_COUNT];
+    Node* wayLast[WAY_LEVELS][WAY_COUNT];
+    int wayCount[WAY_LEVELS] = {};
+
+    // number of levels that have been used so far
+    int levelsUsed = 0;
+
+    // current node; start at the first node of the chain
+    Node* currNode = first;
+
+    while (currNode != nullptr) {
+
+        // cut the next run off of the chain, in non-decreasing order
+        Node* runLast;
+        intmax_t runLength;
+        Node* runFirst = takeRun(currNode, runLast, runLength, less);
+
+        // carry the run up through the bins, merging it with each full
+        // bin it reaches; the chain already in a bin holds earlier nodes,
+        // so it goes on the left to keep the sort stable
+        int i = 0;
+        while ((i < BIN_COUNT - 1) && (binFirst[i] != nullptr)) {
+            runFirst = merge(binFirst[i], binLast[i], runFirst, runLast, runLast, less);
+            runLength += binLength[i];
+            binFirst[i] = nullptr;
+            i++;
+        }
+
+        // if the last bin is full, the carry is merged into it instead
+        if (binFirst[i] != nullptr) {
+            runFirst = merge(binFirst[i], binLast[i], runFirst, runLast, runLast, less);
+            runLength += binLength[i];
+            binFirst[i] = nullptr;
+        }
+
+        // store a carried chain that fits in the cache in the first empty bin
+        if (runLength < bigLength) {
+            binFirst[i] = runFirst;
+            binLast[i] = runLast;
+            binLength[i] = runLength;
+            if (i >= binsUsed) {
+                binsUsed = i + 1;
+            }
+            continue;
+        }
+
+        // a longer chain takes any earlier chains still in the bins with
+        // it, so the levels never hold later nodes than the bins
+        runFirst = mergeBins(binFirst, binLast, binsUsed, runFirst, runLast, less);
+
+        // add the chain to the first level, and carry the merge of a full
+        // level up to the next; the last level takes its own merges
+        int j = 0;
+        while (true) {
+
+            wayFirst[j][wayCount[j]] = runFirst;
+            wayLast[j][wayCount[j]] = runLast;
+            wayCount[j]++;
+            if (j >= levelsUsed) {
+                levelsUsed = j + 1;
+            }
+
+            if (wayCount[j] < WAY_COUNT) {
+                break;
+            }
+
+            runFirst = mergeMany(wayFirst[j], wayLast[j], WAY_COUNT, false, runLast, less);
+            wayCount[j] = 0;
+            if (j < WAY_LEVELS - 1) {
+                j++;
+            }
+        }
+    }
+
+    // merge whatever is left in the bins, then merge that with the chains
+    // of each level in turn, which hold earlier nodes, lowest level first
+    Node* sortedLast = nullptr;
+    Node* sortedFirst = mergeBins(binFirst, binLast, binsUsed, nullptr, sortedLast, less);
+
+    // the highest level that holds chains makes the last merge, which
+    // links the nodes back as well; without one, the chain fits in the
+    // cache and is linked back in a walk over it
+    int lastLevel = levelsUsed - 1;
+    while ((lastLevel >= 0) && (wayCount[lastLevel] == 0)) {
+        lastLevel--;
+    }
+    if (lastLevel < 0) {
+        relinkPrev(Links::next(sortedFirst), sortedFirst);
+    }
+
+    for (int j = 0; j <= lastLevel; j++) {
+
+        if (wayCount[j] == 0) {
+            continue;
+        }
+
+        if (sortedFirst != nullptr) {
+            wayFirst[j][wayCount[j]] = sortedFirst;
+            wayLast[j][wayCount[j]] = sortedLast;
+            wayCount[j]++;
+        }
+
+        sortedFirst = mergeMany(wayFirst[j], wayLast[j], wayCount[j], j == lastLevel,
+                                sortedLast, less);
+    }
+
+    last = sortedLast;
+    return sortedFirst;
+}
+
+template <typename Node, typename Links>
+template <typename Less>
+Node* ChainSort<Node, Links>::merge(Node* a, Node* aLast, Node* b, Node* bLast,
+                                    Node*& last, Less& less) {
+
+    // if every node of `a` comes before every node of `b`, link them
+    if (!less(b, aLast)) {
+        Links::next(aLast) = b;
+        last = bLast;
+        return a;
+    }
+
+    // the merged chain is built by rewriting the link that points to the
+    // next node; start with the link to the first node
+    Node* first = nullptr;
+    Node** link = &first;
+
+    // while both chains have nodes
+    while ((a != nullptr) && (b != nullptr)) {
+
+        // link the smaller node next; take from `a` on ties so the sort
+        // is stable
+        if (!less(b, a)) {
+            *link = a;
+            link = &Links::next(a);
+            a = Links::next(a);
+        } else {
+            *link = b;
+            link = &Links::next(b);
+            b = Links::next(b);
+        }
+    }
+
+    // whichever chain still has nodes is already sorted; link all of it,
+    // and its last node becomes the last node of the merged chain
+    if (a != nullptr) {
+        *link = a;
+        last = aLast;
+    } else {
+        *link = b;
+        last = bLast;
+    }
+
+    return first;
+}
+
+template <typename Node, typename Links>
+template <typename Less>
+Node* ChainSort<Node, Links>::mergeMany(Node** firsts, Node** lasts, int count,
+                                        bool linkBack, Node*& last, Less& less) {
+
+    // a single chain is already merged
+    if (count == 1) {
+        if (linkBack) {
+            relinkPrev(Links::next(firsts[0]), firsts[0]);
+        }
+        last = lasts[0];
+        return firsts[0];
+    }
+
+    // the next node of every chain, made up to a power of two with empty
+    // chains; the node after each next node is fetched into the cache
+    // ahead of time, since a chain is usually not needed again until
+    // nodes of several other chains have been linked
+    int size = 2;
+    while (size < count) {
+        size *= 2;
+    }
+    Node* heads[WAY_COUNT];
+    for (int i = 0; i < size; i++) {
+        heads[i] = (i < count) ? firsts[i] : nullptr;
+        if (heads[i] != nullptr) {
+            __builtin_prefetch(Links::next(heads[i]));
+        }
+    }
+
+    // return true if the next node of chain `x` goes before that of chain
+    // `y`; empty chains go last, and of two equal nodes the one from the
+    // earlier chain goes first, so the sort stays stable
+    auto goesBefore = [&heads, &less](int x, int y) {
+        if (heads[y] == nullptr) {
+            return true;
+        }
+        if (heads[x] == nullptr) {
+            return false;
+        }
+        return (x < y) ? !less(heads[y], heads[x]) : less(heads[x], heads[y]);
+    };
+
+    // a tree of losers: a match between two chains is played at each node
+    // of the tree, which keeps the chain that lost while the winner goes
+    // up to the next match; when the overall winner moves on to its next
+    // node, only the matches on its path to the root are played again
+    // see: https://en.wikipedia.org/wiki/K-way_merge_algorithm
+    int losers[WAY_COUNT];
+    int winners[2 * WAY_COUNT];
+    for (int i = 0; i < size; i++) {
+        winners[size + i] = i;
+    }
+    for (int n = size - 1; n > 0; n--) {
+        int a = winners[2 * n];
+        int b = winners[(2 * n) + 1];
+        bool aWins = goesBefore(a, b);
+        winners[n] = aWins ? a : b;
+        losers[n] = aWins ? b : a;
+    }
+    int winner = winners[1];
+
+    // the merged chain is built by rewriting the link that points to the
+    // next node; start with the link to the first node
+    Node* first = nullptr;
+    Node** link = &first;
+
+    // the node linked last, which the next node is linked back to
+    Node* prevNode = nullptr;
+
+    // number of chains that still have nodes
+    int remaining = count;
+
+    while (true) {
+
+        // link the next node of the winning chain, and move the chain on
+        Node* node = heads[winner];
+        *link = node;
+        if (linkBack) {
+            Links::prev(node) = prevNode;
+        }
+        prevNode = node;
+        link = &Links::next(node);
+        heads[winner] = *link;
+
+        if (heads[winner] != nullptr) {
+            __builtin_prefetch(Links::next(heads[winner]));
+        } else {
+            remaining--;
+        }
+
+        // play the matches on the chain's path to the root again
+        for (int n = (size + winner) / 2; n > 0; n /= 2) {
+            if (goesBefore(losers[n], winner)) {
+                int loser = winner;
+                winner = losers[n];
+                losers[n] = loser;
+            }
+        }
+
+        // once only one chain has nodes left, link all of it
+        if (remaining == 1) {
+            *link = heads[winner];
+            if (linkBack) {
+                relinkPrev(heads[winner], prevNode);
+            }
+            last = lasts[winner];
+            return first;
+        }
+    }
+}
+
+template <typename Node, typename Links>
+template <typename Less>
+Node* ChainSort<Node, Links>::mergeBins(Node** binFirst, Node** binLast, int binsUsed,
+                                        Node* first, Node*& last, Less& less) {
+
+    // bins further up hold earlier nodes, so each bin goes on the left of
+    // everything merged so far
+    for (int i = 0; i < binsUsed; i++) {
+
+        if (binFirst[i] == nullptr) {
+            continue;
+        }
+
+        if (first == nullptr) {
+            first = binFirst[i];
+            last = binLast[i];
+        } else {
+            first = merge(binFirst[i], binLast[i], first, last, last, less);
+        }
+
+        binFirst[i] = nullptr;
+    }
+
+    return first;
+}
+
+template <typename Node, typename Links>
+void ChainSort<Node, Links>::relinkPrev(Node* node, Node* prevNode) {
+
+    while (node != nullptr) {
+        Links::prev(node) = prevNode;
+        prevNode = node;
+        node = Links::next(node);
+    }
+}
+
+template <typename Node, typename Links>
+template <typename Less>
+Node* ChainSort<Node, Links>::takeRun(Node*& node, Node*& last, intmax_t& length,
+                                      Less& less) {
+
+    // the run starts with a single node
+    Node* first = node;
+    last = node;
+    length = 1;
+    node = Links::next(node);
+
+    if ((node != nullptr) && less(node, first)) {
+
+        // a strictly descending run is reversed as it is found by putting
+        // each node in front of the ones before it; equal nodes never form
+        // part of a descending run, so the sort stays stable
+        Node* prevNode = first;
+        while ((node != nullptr) && less(node, prevNode)) {
+            Node* nextNode = Links::next(node);
+            Links::next(node) = first;
+            first = node;
+            prevNode = node;
+            node = nextNode;
+            length++;
+        }
+
+    } else {
+
+        // move down the chain as long as the nodes do not decrease
+        while ((node != nullptr) && !less(node, last)) {
+            last = node;
+            node = Links::next(node);
+            length++;
+        }
+    }
+
+    Links::next(last) = nullptr;
+    return first;
+}
@@ -0,0 +1,406 @@
+#include <iostream>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+#include "CompactDoublyLinkedList.h"
+
+// CONSTRUCTOR
+CompactDoublyLinkedList::CompactDoublyLinkedList()
+        : nodes{}, freeList{COMPACT_NO_NODE}, head{COMPACT_NO_NODE},
+          tail{COMPACT_NO_NODE}, length{0}, cursorNode{COMPACT_NO_NODE},
+          cursorIdx{0} {
+
+    /* constructor has an empty body */
+
+}
+
+// CONSTRUCTOR
+CompactDoublyLinkedList::CompactDoublyLinkedList(const CompactDoublyLinkedList& l,
+                                                 intmax_t startIdx, intmax_t len)
+        : nodes{}, freeList{COMPACT_NO_NODE}, head{COMPACT_NO_NODE},
+          tail{COMPACT_NO_NODE}, length{0}, cursorNode{COMPACT_NO_NODE},
+          cursorIdx{0} {
+
+    // current node; start at the head of the list provided
+    uint32_t currNode = l.head;
+
+    // move down the list until the node at index `startIdx` is reached
+    for (intmax_t i = 0; (i < startIdx) && (currNode != COMPACT_NO_NODE); i++) {
+        currNode = l.nodes[currNode].next;
+    }
+
+    // iterate through `len` nodes (or until the end of the list is
+    // reached) beginning at currNode
+    for (intmax_t i = 0; (i < len) && (currNode != COMPACT_NO_NODE); i++) {
+
+        // add the value of the current node being copied to the new list
+        append(l.nodes[currNode].value);
+
+        // move to the next node in the list being copied
+        currNode = l.nodes[currNode].next;
+    }
+}
+
+// DESTRUCTOR
+CompactDoublyLinkedList::~CompactDoublyLinkedList() {
+
+    // every node lives in the node array, which frees its own memory
+
+    // set head and tail indices to the null index
+    head = COMPACT_NO_NODE;
+    tail = COMPACT_NO_NODE;
+}
+
+int CompactDoublyLinkedList::popFront(void) {
+
+    // if there's nothing to pop throw an out of range error
+    if (length == 0) {
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // if there is only one element
+    if (length == 1) {
+
+        // store the value of the only element
+        int v = nodes[head].value;
+
+        // reset the list to empty state
+        clear();
+
+        // return the value
+        return v;
+    }
+
+    // store the location of the head node and its value
+    uint32_t nodeToPop = head;
+    int v = nodes[head].value;
+
+    // set the second node as the head node
+    head = nodes[head].next;
+
+    // set the `prev` link of the new head to the null index
+    nodes[head].prev = COMPACT_NO_NODE;
+
+    // every index after the old head moved down by one; if the cursor was
+    // on the old head, forget it
+    if (cursorNode == nodeToPop) {
+        cursorNode = COMPACT_NO_NODE;
+    } else {
+        cursorIdx--;
+    }
+
+    // put the old head node on the free list
+    destroyNode(nodeToPop);
+
+    // decrement the length by one
+    decrementLength();
+
+    return v;
+}
+
+int& CompactDoublyLinkedList::at(int idx) {
+
+    // if the specified index does not exist
+    if ((idx < 0) || (idx >= length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // start at the head, the tail, or the node last reached by a walk,
+    // whichever is the fewest nodes away from the index
+    uint32_t currNode = head;
+    intmax_t currIdx = 0;
+
+    if ((length - 1 - idx) < idx) {
+        currNode = tail;
+        currIdx = length - 1;
+    }
+
+    if ((cursorNode != COMPACT_NO_NODE) &&
+        (std::abs(cursorIdx - idx) < std::abs(currIdx - idx))) {
+        currNode = cursorNode;
+        currIdx = cursorIdx;
+    }
+
+    // walk forward or backward until the desired node is reached
+    while (currIdx < idx) {
+        currNode = nodes[currNode].next;
+        currIdx++;
+    }
+    while (currIdx > idx) {
+        currNode = nodes[currNode].prev;
+        currIdx--;
+    }
+
+    // remember where the walk ended so the next walk can start there
+    cursorNode = currNode;
+    cursorIdx = currIdx;
+
+    return nodes[currNode].value;
+}
+
+void CompactDoublyLinkedList::append(int i) {
+
+    // create a new node holding the value, linked after the current tail
+    uint32_t newNode = createNode(i);
+    nodes[newNode].prev = tail;
+
+    // if the list is empty the new node is also the head; otherwise, link
+    // the current tail to the new node
+    if (length == 0) {
+        head = newNode;
+    } else {
+        nodes[tail].next = newNode;
+    }
+
+    // set the new node as the tail of the list
+    tail = newNode;
+
+    // increment length
+    incrementLength();
+}
+
+void CompactDoublyLinkedList::prepend(int i) {
+
+    // create a new node holding the value, linked before the current head
+    uint32_t newNode = createNode(i);
+    nodes[newNode].next = head;
+
+    // if the list is empty the new node is also the tail; otherwise, link
+    // the current head to the new node
+    if (length == 0) {
+        tail = newNode;
+    } else {
+        nodes[head].prev = newNode;
+    }
+
+    // set the new node as the head of the list
+    head = newNode;
+
+    // every index after the new head moved up by one
+    cursorIdx++;
+
+    // increment length
+    incrementLength();
+}
+
+void CompactDoublyLinkedList::concatenate(const CompactDoublyLinkedList& rightList) {
+
+    // make room for every node at once, so the array grows at most once;
+    // the array at least doubles when it grows, so that repeated calls
+    // still take amortized O(1) per node rather than copying the whole
+    // array every time
+    std::size_t needed = nodes.size() + rightList.length;
+    if (needed > nodes.capacity()) {
+        nodes.reserve(std::max(2 * nodes.capacity(), needed));
+    }
+
+    // start at the head of the list supplied in the function call
+    uint32_t currNode = rightList.head;
+
+    // iterate through each node in the supplied List
+    while (currNode != COMPACT_NO_NODE) {
+
+        // copy the value of the node to the calling List
+        append(rightList.nodes[currNode].value);
+
+        // move to the next mode in the supplied List
+        currNode = rightList.nodes[currNode].next;
+    }
+}
+
+void CompactDoublyLinkedList::clear(void) {
+
+    // every node lives in the node array; emptying the array frees all of
+    // the nodes at once and keeps its memory for reuse
+    nodes.clear();
+    freeList = COMPACT_NO_NODE;
+
+    // set head and tail indices to the null index
+    head = COMPACT_NO_NODE;
+    tail = COMPACT_NO_NODE;
+
+    // the node the cursor was on no longer exists
+    cursorNode = COMPACT_NO_NODE;
+
+    // reset length to 0
+    length = 0;
+}
+
+void CompactDoublyLinkedList::bubbleSort(void) {
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // remains true if the list is sorted; otherwise, changed to false
+    bool sorted = false;
+
+    while (!sorted) {
+
+        // if no values are swapped after an iteration through the list, it is sorted
+        sorted = true;
+
+        // start at the head of the list
+        uint32_t currNode = head;
+
+        while (nodes[currNode].next != COMPACT_NO_NODE) {
+
+            CompactNode& curr = nodes[currNode];
+            CompactNode& next = nodes[curr.next];
+
+            // if the current and next value are out of order
+            if (next.value < curr.value) {
+
+                // swap the values of the current and next node
+                int temp = curr.value;
+                curr.value = next.value;
+                next.value = temp;
+
+                // set sorted to false
+                sorted = false;
+            }
+
+            // move to the next node
+            currNode = curr.next;
+        }
+    }
+}
+
+void CompactDoublyLinkedList::mergeSort(void) {
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // copy the values of the list into a contiguous buffer in list order
+    std::vector<int> values{};
+    values.reserve(length);
+
+    for (uint32_t currNode = head; currNode != COMPACT_NO_NODE; currNode = nodes[currNode].next) {
+        values.push_back(nodes[currNode].value);
+    }
+
+    // merge sort the buffer
+    std::stable_sort(values.begin(), values.end());
+
+    // write the sorted values back into the nodes in one pass
+    intmax_t k = 0;
+    for (uint32_t currNode = head; currNode != COMPACT_NO_NODE; currNode = nodes[currNode].next) {
+        nodes[currNode].value = values[k++];
+    }
+}
+
+void CompactDoublyLinkedList::writeTo(int fd) {
+
+    // the values are formatted into a buffer, which is written to the file
+    // descriptor each time it fills up
+    OutputBuffer buffer{fd};
+    putValues(buffer);
+    buffer.flush();
+}
+
+uint32_t CompactDoublyLinkedList::createNode(int value) {
+
+    uint32_t node = freeList;
+
+    // reuse a node from the free list if there is one
+    if (node != COMPACT_NO_NODE) {
+        freeList = nodes[node].next;
+        nodes[node] = CompactNode{value, COMPACT_NO_NODE, COMPACT_NO_NODE};
+        return node;
+    }
+
+    // the null index cannot be used as the index of a node
+    if (nodes.size() == COMPACT_NO_NODE) {
+        throw std::overflow_error{"CompactDoublyLinkedList length exceeded "
+                                  "max"};
+    }
+
+    // otherwise, add a node that is not linked to any others to the end of
+    // the array
+    nodes.push_back(CompactNode{value, COMPACT_NO_NODE, COMPACT_NO_NODE});
+
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+void CompactDoublyLinkedList::destroyNode(uint32_t node) {
+
+    // push the node onto the front of the free list
+    nodes[node].next = freeList;
+    freeList = node;
+}
+
+void CompactDoublyLinkedList::putValues(OutputBuffer& buffer) {
+
+    // number of values put in the buffer so far
+    intmax_t printed = 0;
+
+    // the buffer writes bytes, which the compiler has to assume could
+    // change the vector, so the array address is read once here
+    const CompactNode* array = nodes.data();
+
+    for (uint32_t currNode = head; currNode != COMPACT_NO_NODE; currNode = array[currNode].next) {
+
+        // every value but the first is preceded by a comma
+        if (printed > 0) {
+            buffer.put(", ", 2);
+
+            // print 25 values per line
+            if ((printed % 25) == 0) {
+                buffer.put("\n", 1);
+            }
+        }
+
+        buffer.put(array[currNode].value);
+        printed++;
+    }
+}
+
+void CompactDoublyLinkedList::incrementLength(void) {
+
+    // if the value of length will overflow upon being incremented
+    if (length == INTMAX_MAX) {
+
+        // throw an error
+        throw std::overflow_error{"CompactDoublyLinkedList length exceeded "
+                                  "max"};
+
+    } else {
+
+        // increment length
+        length++;
+    }
+}
+
+void CompactDoublyLinkedList::decrementLength(void) {
+
+    // if the list already has no elements
+    if (length == 0) {
+
+        // throw and error
+        throw std::underflow_error{"CompactDoublyLinkedList length cannot be "
+                                   "shortened below zero"};
+
+    } else {
+
+        // decrement length
+        length--;
+    }
+}
+
+std::ostream& operator<<(std::ostream& outStream, CompactDoublyLinkedList& linkedList) {
+
+    // the values are formatted into a buffer, which is sent to the stream
+    // in large blocks rather than one value at a time
+    OutputBuffer buffer{outStream};
+    linkedList.putValues(buffer);
+    buffer.flush();
+
+    return outStream;
+}
@@ -0,0 +1,144 @@
+#ifndef COMPACTDOUBLYLINKEDLIST_H
+#define COMPACTDOUBLYLINKEDLIST_H
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "OutputBuffer.h"
+
+// link value that does not refer to any node (the null index)
+const uint32_t COMPACT_NO_NODE{UINT32_MAX};
+
+// the nodes of a Compact List are linked by their index in the list's
+// node array rather than by address, so a node is 12 bytes instead of 24
+struct CompactNode {
+    int value;
+    uint32_t prev;
+    uint32_t next;
+};
+
+// a Compact Doubly-Linked List stores the same sequence of values as a
+// DoublyLinkedList, but keeps every node in one growable array and links
+// them with 32-bit indices; each value takes 12 bytes instead of 24, and
+// nodes that were added one after another sit next to each other in
+// memory; freed nodes are kept on a free list inside the array and used
+// again before the array grows; holds at most 2^32 - 1 values
+class CompactDoublyLinkedList {
+
+    // friend function to put the list to an output stream
+    friend std::ostream& operator<<(std::ostream&, CompactDoublyLinkedList&);
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    CompactDoublyLinkedList(const CompactDoublyLinkedList&) = delete;
+    CompactDoublyLinkedList& operator=(const CompactDoublyLinkedList&) = delete;
+    CompactDoublyLinkedList(CompactDoublyLinkedList&&) = delete;
+    CompactDoublyLinkedList& operator=(CompactDoublyLinkedList&&) = delete;
+
+public:
+
+    // constructor method for a empty list;
+    // initializes head and tail indices to the null index, and length to 0
+    CompactDoublyLinkedList(void);
+
+    // constructor method to make a copy of a list;
+    // must be given a List object, an index number at which to start,and
+    // a number of values to copy (i.e. length)
+    CompactDoublyLinkedList(const CompactDoublyLinkedList& l, intmax_t startIdx,
+                            intmax_t len);
+
+    // destructor method frees the memory given to the nodes in the list
+    ~CompactDoublyLinkedList();
+
+    // return the length of the list
+    int getLength(void) const { return length; };
+
+    // remove the first element from the List are return its value
+    int popFront(void);
+
+    // return a reference to the value stored at the specified index; walks
+    // from whichever of the head, tail or the node reached by the previous
+    // walk is closest; the reference is only valid until a value is added,
+    // since adding a value may move the node array
+    int& at(int idx);
+
+    // add the supplied value to the end of the list; increment length by one
+    void append(int i);
+
+    // add the supplied value to the beginning of the list; increment length by one
+    void prepend(int i);
+
+    // add all of the elements of the supplied List to the end of the calling List;
+    // this function creates a copy of each of the values of the supplied List
+    void concatenate(const CompactDoublyLinkedList&);
+
+    // delete all of the elements from the List and reset the length to 0;
+    // the node array keeps its memory for reuse
+    void clear(void);
+
+    // sort the values in the array using bubble sort method
+    // see: https://en.wikipedia.org/wiki/Bubble_sort
+    void bubbleSort(void);
+
+    // sort the values in the array using merge sort method; the values are
+    // gathered in list order, sorted, and written back in one pass, so the
+    // links are not changed
+    // see: https://en.wikipedia.org/Merge_sort
+    void mergeSort(void);
+
+    // write the values of the list to a file descriptor in the same layout
+    // as operator<<, in large blocks with write(2); throws system_error if
+    // the write fails
+    void writeTo(int fd);
+
+    // return the number of bytes of memory held by the node array
+    std::size_t getMemoryUsage(void) const { return nodes.capacity() * sizeof(CompactNode); };
+
+private:
+
+    // take a node from the free list, or add one to the end of the node
+    // array, holding the supplied value; returns its index
+    uint32_t createNode(int value);
+
+    // put a node on the free list
+    void destroyNode(uint32_t node);
+
+    // put every value in the supplied buffer, separated by commas with 25
+    // values per line
+    void putValues(OutputBuffer& buffer);
+
+    // increment length by 1
+    void incrementLength(void);
+
+    // decrement (decrease) length by 1
+    void decrementLength(void);
+
+    // every node of the list, in the order they were created; freed nodes
+    // stay in the array and are linked into the free list by `next`
+    std::vector<CompactNode> nodes;
+
+    // the index of the first free node in the array
+    uint32_t freeList;
+
+    // the index of the first node in the list
+    uint32_t head;
+
+    // the index of the last node in the list
+    uint32_t tail;
+
+    // the length of the list in number of values/nodes
+    intmax_t length;
+
+    // the node reached by the most recent walk and its position in the
+    // list; the null index when no walk has happened since the last change
+    // that moved values around
+    uint32_t cursorNode;
+    intmax_t cursorIdx;
+};
+
+std::ostream& operator<<(std::ostream& outStream, CompactDoublyLinkedList& linkedList);
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef CONCURRENTDEQUE_H
+#define CONCURRENTDEQUE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+// nodes of a Concurrent Deque; the value is kept in raw storage so the
+// dummy node at the front of the deque does not need a value
+template <typename T>
+struct ConcurrentNode {
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::atomic<ConcurrentNode*> next;
+};
+
+// a Concurrent Deque is a linked list that many threads can use at once
+// as a work queue: producers append (or prepend) values and consumers pop
+// them from the front; it is a two-lock queue, so the front and the back
+// each have their own lock and an append never waits for a pop;
+// the front of the deque is always a dummy node holding no value, so the
+// two ends only meet, and prepend only takes both locks, when it is empty;
+// a node is only freed by the thread popping it while holding the front
+// lock, and no other thread can still be reading it, so no hazard pointers
+// or epochs are needed to reclaim memory safely
+template <typename T>
+class ConcurrentDeque {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    ConcurrentDeque(const ConcurrentDeque&) = delete;
+    ConcurrentDeque& operator=(const ConcurrentDeque&) = delete;
+    ConcurrentDeque(ConcurrentDeque&&) = delete;
+    ConcurrentDeque& operator=(ConcurrentDeque&&) = delete;
+
+public:
+
+    // constructor method for an empty deque
+    ConcurrentDeque(void);
+
+    // destructor method destroys every value and frees every node; no
+    // other thread may be using the deque
+    ~ConcurrentDeque();
+
+    // return the number of values in the deque; only a snapshot if other
+    // threads are adding or removing values
+    intmax_t getLength(void) const { return length.load(std::memory_order_relaxed); };
+
+    // add a value to the end of the deque; only takes the back lock
+    void append(const T& v) { linkBack(createNode(v)); };
+    void append(T&& v) { linkBack(createNode(std::move(v))); };
+
+    // add a value to the front of the deque; only takes the front lock
+    // unless the deque is empty
+    void prepend(const T& v) { linkFront(createNode(v)); };
+    void prepend(T&& v) { linkFront(createNode(std::move(v))); };
+
+    // move the first value into `out` and remove it from the deque;
+    // returns false, leaving `out` unchanged, if the deque is empty
+    bool tryPopFront(T& out);
+
+    // remove and return the first value of the deque; throws out_of_range
+    // if the deque is empty
+    T popFront(void);
+
+private:
+
+    // allocate a node holding a value made from the supplied arguments
+    template <typename... Args>
+    ConcurrentNode<T>* createNode(Args&&... args);
+
+    // link a node created by createNode() to the back or front of the deque
+    void linkBack(ConcurrentNode<T>* node);
+    void linkFront(ConcurrentNode<T>* node);
+
+    // return the address of the value held by a node
+    static T* valueOf(ConcurrentNode<T>* node) {
+        return std::launder(reinterpret_cast<T*>(node->storage));
+    };
+
+    // the front and back are on separate cache lines so threads working at
+    // one end do not slow down threads working at the other
+
+    // the dummy node before the first value, and the lock for the front
+    alignas(64) std::mutex headMutex;
+    ConcurrentNode<T>* head;
+
+    // the last node of the deque (the dummy node if it is empty), and the
+    // lock for the back
+    alignas(64) std::mutex tailMutex;
+    ConcurrentNode<T>* tail;
+
+    // number of values in the deque
+    alignas(64) std::atomic<intmax_t> length;
+};
+
+// the implementation of the class template
+#include "ConcurrentDeque.tpp"
+
+#endif
@@ -0,0 +1,175 @@
+#include <stdexcept>
+#include <utility>
+
+// CONSTRUCTOR
+template <typename T>
+ConcurrentDeque<T>::ConcurrentDeque()
+        : head{nullptr}, tail{nullptr}, length{0} {
+
+    // an empty deque is a single dummy node that is both head and tail
+    head = new ConcurrentNode<T>;
+    head->next.store(nullptr, std::memory_order_relaxed);
+    tail = head;
+}
+
+// DESTRUCTOR
+template <typename T>
+ConcurrentDeque<T>::~ConcurrentDeque() {
+
+    // the dummy node holds no value; every node after it does
+    ConcurrentNode<T>* currNode = head->next.load(std::memory_order_relaxed);
+    delete head;
+
+    while (currNode != nullptr) {
+
+        // store the address of the next node
+        ConcurrentNode<T>* nextNode = currNode->next.load(std::memory_order_relaxed);
+
+        // destroy the value and free the node
+        valueOf(currNode)->~T();
+        delete currNode;
+
+        // move to the next node
+        currNode = nextNode;
+    }
+
+    // set head and tail pointers to null
+    head = nullptr;
+    tail = nullptr;
+}
+
+template <typename T>
+bool ConcurrentDeque<T>::tryPopFront(T& out) {
+
+    // the node to free once the front lock has been released
+    ConcurrentNode<T>* oldDummy = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock{headMutex};
+
+        // the first value is held by the node after the dummy node; the
+        // acquire pairs with the release in linkBack() and linkFront(), so
+        // the value is fully constructed before it is read
+        ConcurrentNode<T>* first = head->next.load(std::memory_order_acquire);
+
+        // if there's nothing to pop report failure
+        if (first == nullptr) {
+            return false;
+        }
+
+        // move the value out; its node becomes the new dummy node
+        T* value = valueOf(first);
+        out = std::move(*value);
+        value->~T();
+
+        oldDummy = head;
+        head = first;
+
+        length.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // the old dummy node had a next node, so it is not the tail and no
+    // appending thread can be using it; free it outside of the lock
+    delete oldDummy;
+
+    return true;
+}
+
+template <typename T>
+T ConcurrentDeque<T>::popFront(void) {
+
+    // the node to free once the front lock has been released
+    ConcurrentNode<T>* oldDummy = nullptr;
+
+    std::unique_lock<std::mutex> lock{headMutex};
+
+    ConcurrentNode<T>* first = head->next.load(std::memory_order_acquire);
+
+    // if there's nothing to pop throw an out of range error
+    if (first == nullptr) {
+        throw std::out_of_range{"deque index out of range"};
+    }
+
+    // move the value out; its node becomes the new dummy node
+    T* value = valueOf(first);
+    T v{std::move(*value)};
+    value->~T();
+
+    oldDummy = head;
+    head = first;
+
+    length.fetch_sub(1, std::memory_order_relaxed);
+
+    lock.unlock();
+
+    // free the old dummy node outside of the lock
+    delete oldDummy;
+
+    return v;
+}
+
+template <typename T>
+template <typename... Args>
+ConcurrentNode<T>* ConcurrentDeque<T>::createNode(Args&&... args) {
+
+    // the node is allocated and its value constructed before any lock is
+    // taken, so the critical sections only relink pointers
+    ConcurrentNode<T>* node = new ConcurrentNode<T>;
+
+    try {
+        new (node->storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+        delete node;
+        throw;
+    }
+
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    return node;
+}
+
+template <typename T>
+void ConcurrentDeque<T>::linkBack(ConcurrentNode<T>* node) {
+
+    std::lock_guard<std::mutex> lock{tailMutex};
+
+    // publish the node after the current tail; popping threads read this
+    // pointer while holding only the front lock
+    tail->next.store(node, std::memory_order_release);
+    tail = node;
+
+    length.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void ConcurrentDeque<T>::linkFront(ConcurrentNode<T>* node) {
+
+    std::lock_guard<std::mutex> headLock{headMutex};
+
+    ConcurrentNode<T>* first = head->next.load(std::memory_order_acquire);
+
+    // only threads holding the front lock remove values, so a deque that
+    // is not empty now stays that way; the node goes after the dummy node
+    // without touching the tail
+    if (first != nullptr) {
+        node->next.store(first, std::memory_order_relaxed);
+        head->next.store(node, std::memory_order_release);
+        length.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // the deque is empty, so the dummy node is also the tail; take the
+    // back lock (always after the front lock) and check again, since a
+    // value may have been appended in the meantime
+    std::lock_guard<std::mutex> tailLock{tailMutex};
+
+    first = head->next.load(std::memory_order_acquire);
+    node->next.store(first, std::memory_order_relaxed);
+    head->next.store(node, std::memory_order_release);
+
+    if (first == nullptr) {
+        tail = node;
+    }
+
+    length.fetch_add(1, std::memory_order_relaxed);
+}
@@ -4,74 +4,447 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "NodePool.h"
+#include "OutputBuffer.h"
+#include "ListStats.h"
+#include "ChainSort.h"
+
+// a read-only window over part of a list; defined in ListView.h
+template <typename T, typename Allocator>
+class ListView;
 
 // Linked Lists are made up of nodes connected by pointers
-struct Node { int value; Node* prev; Node* next; };
+template <typename T>
+struct Node { T value; Node* prev; Node* next; };
 
 // a Doubly-Linked List is an expandable data type that uses dynamic
 // memory allocation and pointers to store an abstract number of values;
 // the `Doubly` part of the name refers to the fact that each node in
-// the list points to both the previous and next node/element in the list
+// the list points to both the previous and next node/element in the list;
+// the nodes are taken from the supplied allocator, which by default is a
+// PoolAllocator that gives each list its own slab-backed NodePool
+template <typename T, typename Allocator = PoolAllocator<T>>
 class DoublyLinkedList {
 
     // friend function to put the list to an output stream
-    friend std::ostream& operator<<(std::ostream&, DoublyLinkedList&);
+    template <typename U, typename A>
+    friend std::ostream& operator<<(std::ostream&, DoublyLinkedList<U, A>&);
+
+    // views read the nodes of the list they refer to
+    friend class ListView<T, Allocator>;
+
+    // the allocator type that is used for nodes rather than values
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    // only lets a template take part in overload resolution when the type
+    // is a forward iterator, so that append(first, last) is never picked
+    // for two values
+    template <typename It>
+    using RequireForwardIterator = std::enable_if_t<std::is_base_of_v<
+        std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>>;
 
     // delete some special member functions so the compiler does not
-    // create default versions of them
+    // create default versions of them; use the sub-list constructor to
+    // copy a list
     DoublyLinkedList(const DoublyLinkedList&) = delete;
     DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
-    DoublyLinkedList(DoublyLinkedList&&) = delete;
-    DoublyLinkedList& operator=(DoublyLinkedList&&) = delete;
+
+    // bidirectional iterator over the values of the list; `IsConst`
+    // selects whether the values can be changed through the iterator
+    template <bool IsConst>
+    class ListIterator {
+
+        // the list creates iterators from its nodes
+        friend class DoublyLinkedList;
+
+        // views create iterators over the nodes of their list
+        friend class ListView<T, Allocator>;
+
+        // a const iterator can be made from a non-const one
+        friend class ListIterator<!IsConst>;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        // constructor method for an iterator that does not refer to a list
+        ListIterator(void) : node{nullptr}, list{nullptr} {};
+
+        // constructor method to make a const iterator from a non-const one
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        ListIterator(const ListIterator<OtherConst>& other)
+                : node{other.node}, list{other.list} {}
+
+        reference operator*(void) const { return node->value; };
+        pointer operator->(void) const { return std::addressof(node->value); };
+
+        // move to the next value
+        ListIterator& operator++(void) { node = node->next; return *this; };
+        ListIterator operator++(int) { ListIterator old{*this}; node = node->next; return old; };
+
+        // move to the previous value; the end iterator moves to the tail
+        ListIterator& operator--(void) {
+            node = (node == nullptr) ? list->tail : node->prev;
+            return *this;
+        };
+        ListIterator operator--(int) { ListIterator old{*this}; --(*this); return old; };
+
+        bool operator==(const ListIterator& other) const { return node == other.node; };
+        bool operator!=(const ListIterator& other) const { return node != other.node; };
+
+    private:
+
+        // constructor method for an iterator at the supplied node; a null
+        // node is the end of the list
+        ListIterator(Node<T>* node, const DoublyLinkedList* list)
+                : node{node}, list{list} {};
+
+        // the node the iterator refers to, and the list it belongs to
+        Node<T>* node;
+        const DoublyLinkedList* list;
+    };
 
 public:
 
+    // types used by the standard library to work with containers
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = ListIterator<false>;
+    using const_iterator = ListIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     // constructor method for a empty list;
     // initializes head and tail node pointers to null, and length to 0
     DoublyLinkedList(void);
 
+    // constructor method for an empty list that takes its nodes from the
+    // supplied allocator
+    explicit DoublyLinkedList(const Allocator& alloc);
+
     // constructor method to make a copy of a list;
     // must be given a List object, an index number at which to start,and
     // a number of nodes to copy (i.e. length)
     DoublyLinkedList(const DoublyLinkedList& l, intmax_t startIdx, intmax_t len);
 
-    // destructor method frees the memory given to each node in the list
+    // move constructor method takes the nodes of the supplied List in O(1);
+    // the supplied List is left empty
+    DoublyLinkedList(DoublyLinkedList&& l) noexcept;
+
+    // move assignment deletes the elements of the calling List and takes
+    // the nodes of the supplied List; O(1) unless the two Lists have
+    // unequal allocators that do not propagate, in which case each value
+    // is moved into a new node
+    DoublyLinkedList& operator=(DoublyLinkedList&& l);
+
+    // destructor method frees the memory given to the nodes in the list;
+    // when the list is the only user of its node pool, the nodes are freed
+    // with the pool's slabs in O(number of slabs) rather than O(length)
     ~DoublyLinkedList();
 
     // return the length of the list
     int getLength(void) const { return length; };
 
-    // remove the first element from the List are return its value
-    int popFront(void);
+    // remove the first element from the List are return its value; the
+    // value is moved out of the node rather than copied
+    T popFront(void);
+
+    // return a reference to the value stored at the specified index; the
+    // walk starts from the head, the tail, or the node reached by the
+    // previous walk, whichever is closest, so visiting the indices in
+    // order takes O(1) per call
+    T& at(int idx);
 
-    // return a reference to the value stored at the specified index
-    int& at(int idx);
+    // add the supplied value at the specified index, moving the values at
+    // and after that index back by one; increment length by one
+    void insertAt(int idx, T value);
+
+    // remove the value at the specified index from the List and return it
+    T eraseAt(int idx);
 
     // add the supplied value to the end of the list; increment length by one
-    void append(int i);
+    void append(const T& value) { emplace_back(value); };
+    void append(T&& value) { emplace_back(std::move(value)); };
 
     // add the supplied value to the beginning of the list; increment length by one
-    void prepend(int i);
+    void prepend(const T& value) { emplace_front(value); };
+    void prepend(T&& value) { emplace_front(std::move(value)); };
+
+    // add copies of the values in [first, last) to the end of the list, in
+    // order; the nodes are taken from the node pool in runs of neighbouring
+    // blocks rather than one call at a time, linked into a chain in one
+    // tight loop, and length is updated once; if a value cannot be copied,
+    // the list is left as it was
+    template <typename ForwardIt, typename = RequireForwardIterator<ForwardIt>>
+    void append(ForwardIt first, ForwardIt last);
+
+    // add copies of the values in [first, last) to the beginning of the
+    // list, keeping their order; see append(first, last)
+    template <typename ForwardIt, typename = RequireForwardIterator<ForwardIt>>
+    void prepend_range(ForwardIt first, ForwardIt last);
+
+#if __cplusplus >= 202002L
+    // add copies of the values of a contiguous range to the end or the
+    // beginning of the list; only when built as C++20
+    void append(std::span<const T> values) { append(values.begin(), values.end()); }
+    void prepend_range(std::span<const T> values) { prepend_range(values.begin(), values.end()); }
+#endif
+
+    // replace the values of the list with `n` copies of the supplied value
+    void assign(intmax_t n, const T& value);
+
+    // construct a value at the end of the list from the supplied arguments,
+    // without making a temporary copy; returns a reference to the value
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    // construct a value at the beginning of the list from the supplied
+    // arguments; returns a reference to the value
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    // return an iterator to the first value, or to just past the last value
+    iterator begin(void) { return iterator{head, this}; };
+    iterator end(void) { return iterator{nullptr, this}; };
+    const_iterator begin(void) const { return const_iterator{head, this}; };
+    const_iterator end(void) const { return const_iterator{nullptr, this}; };
+    const_iterator cbegin(void) const { return begin(); };
+    const_iterator cend(void) const { return end(); };
+
+    // return an iterator that walks the values from last to first
+    reverse_iterator rbegin(void) { return reverse_iterator{end()}; };
+    reverse_iterator rend(void) { return reverse_iterator{begin()}; };
+    const_reverse_iterator rbegin(void) const { return const_reverse_iterator{end()}; };
+    const_reverse_iterator rend(void) const { return const_reverse_iterator{begin()}; };
+    const_reverse_iterator crbegin(void) const { return rbegin(); };
+    const_reverse_iterator crend(void) const { return rend(); };
+
+    // add the supplied value before the value the iterator refers to (or
+    // at the end, for the end iterator) in O(1); returns an iterator to
+    // the new value
+    iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); };
+    iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); };
+
+    // construct a value from the supplied arguments before the value the
+    // iterator refers to in O(1); returns an iterator to the new value
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+
+    // remove the value the iterator refers to in O(1); returns an iterator
+    // to the value after it
+    iterator erase(const_iterator pos);
 
     // add all of the elements of the supplied List to the end of the calling List;
     // this function creates a copy of each of the nodes of the supplied List
     void concatenate(const DoublyLinkedList&);
 
-    // delete all of the elements from the List and reset the length to 0
+    // move all of the elements of the supplied List to the end of the
+    // calling List, leaving the supplied List empty; see splice()
+    void concatenate(DoublyLinkedList&& rightList) { splice(rightList); };
+
+    // move all of the nodes of the supplied List to the end of the calling
+    // List, leaving the supplied List empty; O(1) when the two Lists have
+    // equal allocators, or when the supplied List is the only user of its
+    // node pool (the calling List's pool takes over its slabs); otherwise
+    // each value is moved into a new node
+    void splice(DoublyLinkedList& rightList);
+
+    // detach the elements from the specified index to the end into a new
+    // List and return it; the new List shares the calling List's allocator,
+    // so no nodes are copied and the only cost is the walk to the index
+    DoublyLinkedList split(int idx);
+
+    // return a view of `len` values beginning at index `startIdx` (or
+    // until the end of the list is reached) without copying them; the walk
+    // to `startIdx` starts from the head, tail or cursor, whichever is
+    // closest, and nothing is allocated; the view is only valid while the
+    // viewed nodes are in the list
+    ListView<T, Allocator> view(intmax_t startIdx, intmax_t len);
+
+    // delete all of the elements from the List and reset the length to 0;
+    // the memory of the nodes is kept by the node pool for reuse
     void clear(void);
 
+    // move the nodes into one block of memory in list order, so walking
+    // the list reads memory from start to end; each value is moved into a
+    // new node and the old nodes are freed, in one O(n) pass; with a
+    // PoolAllocator the new nodes are one contiguous slab, and when the
+    // list is the only user of its pool every other slab is returned to
+    // the heap; iterators, views and references into the list are invalid
+    // afterwards
+    void compact(void);
+
+    // return the share of the links from one node to the next that do not
+    // lead forward to a node within a cache line (64 bytes) of the end of
+    // the node: 0 for a compacted list, and close to 1 for a list whose
+    // nodes are scattered; O(n)
+    double fragmentation(void) const;
+
+    // compact the list at the end of mergeSort and parallelMergeSort
+    // whenever fragmentation() is above `threshold`; a
+    // threshold of 1 or more turns this off, which is the default
+    void setAutoCompact(double threshold) { autoCompactThreshold = threshold; };
+
+    // return the threshold set by setAutoCompact()
+    double getAutoCompact(void) const { return autoCompactThreshold; };
+
     // sort the values in the array using bubble sort method
     // see: https://en.wikipedia.org/wiki/Bubble_sort
     void bubbleSort(void);
 
-    // sort the values in the array using merge sort method
+    // sort the values in the array using merge sort method; this is a
+    // bottom-up natural merge sort that relinks the existing nodes, so it
+    // allocates nothing and every value keeps its node; runs that are
+    // already in order are found first (strictly descending runs are
+    // reversed as they are found), and two chains that are already in
+    // order are joined in O(1), so sorted or reversed input is sorted in
+    // O(n); chains too long for the cache are merged many at a time (see
+    // ChainSort.h)
     // see: https://en.wikipedia.org/Merge_sort
     void mergeSort(void);
 
+    // sort the values in the array using merge sort method on several
+    // threads at once; the chain of nodes is cut into one segment per
+    // thread, the segments are sorted at the same time, and then merged in
+    // pairs, also at the same time; gives the same order as mergeSort;
+    // a thread count of 0 uses one thread per hardware thread; work for a
+    // thread that cannot be started is done on the calling thread instead;
+    // comparing two values must not throw
+    void parallelMergeSort(unsigned threadCount = 0);
+
+    // sort the values in the array using an LSD radix sort; only for lists
+    // of integers; the values are gathered into a contiguous buffer, sorted
+    // one byte at a time with counting passes (passes over a byte that is
+    // the same in every value are skipped), and written back into the
+    // nodes in one sequential pass; the nodes are not relinked
+    // see: https://en.wikipedia.org/wiki/Radix_sort
+    void radixSort(void);
+
+    // sort the values in the array using a top-down merge sort that copies
+    // each half into a new List; kept to compare against mergeSort
+    void copyMergeSort(void);
+
+    // write the values of the list to a file descriptor in the same layout
+    // as operator<<, formatting them into a buffer that is written in large
+    // blocks with write(2); throws system_error if the write fails
+    void writeTo(int fd);
+
+    // write the list to a binary file at the supplied path: a header
+    // holding a magic number, the size of a value and the length, followed
+    // by the values stored one after another; only for lists of trivially
+    // copyable values; throws system_error if the file cannot be written
+    void save(const std::string& path) const;
+
+    // replace the values of the list with the values of a file written by
+    // save(); the file is mapped into memory with mmap and the node chain
+    // is built from it in one sequential pass; throws system_error if the
+    // file cannot be read, and runtime_error if it was not written by
+    // save() for a list of the same value type
+    void load(const std::string& path);
+
+    // return a copy of the allocator the nodes of the list are taken from;
+    // for a PoolAllocator, the heap allocation counter of its pool can be
+    // used to check that a workload reuses nodes
+    Allocator get_allocator(void) const { return Allocator(nodeAlloc); };
+
 private:
 
+    // return `n` nodes that follow one another in memory, taken from the
+    // node pool as one slab; null if the nodes do not come from a pool
+    Node<T>* allocateNodeBlock(intmax_t n);
+
+    // return up to `n` nodes that follow one another in memory, the unused
+    // part of a slab of the node pool, and store how many in `count`; null
+    // (and a count of 0) if the nodes do not come from a pool
+    Node<T>* allocateNodeRun(intmax_t n, intmax_t& count);
+
+    // create a chain of `n` nodes linked in both directions, the first with
+    // a null `prev` and the last with a null `next`; `construct` is called
+    // with the address of each node's value in order and must construct
+    // it; with `oneBlock` every node comes from allocateNodeBlock(), and
+    // otherwise from runs of allocateNodeRun(), when the allocator is a
+    // node pool; returns the first node and stores the last in `last`; if
+    // a value cannot be constructed, every node is given back and nothing
+    // changes
+    template <typename Construct>
+    Node<T>* createChain(intmax_t n, Construct construct, bool oneBlock, Node<T>*& last);
+
+    // link a chain made by createChain() before the supplied node (at the
+    // end for null) and add its `n` nodes to the length, which must not
+    // overflow
+    void linkChain(Node<T>* before, Node<T>* first, Node<T>* last, intmax_t n);
+
+    // take a node from the allocator and construct its value from the
+    // supplied arguments
+    template <typename... Args>
+    Node<T>* createNode(Args&&... args);
+
+    // destroy the value of a node and give the node back to the allocator
+    void destroyNode(Node<T>* node);
+
+    // destroy every node in the list; the list's pointers are not changed
+    void destroyAllNodes(void);
+
+    // how ChainSort reaches the links to the next and previous nodes
+    struct NodeLinks {
+        static Node<T>*& next(Node<T>* node) { return node->next; };
+        static Node<T>*& prev(Node<T>* node) { return node->prev; };
+    };
+
+    // the order ChainSort puts the nodes in: by value, compared with `<`
+    struct ValueLess {
+        bool operator()(const Node<T>* a, const Node<T>* b) const {
+            DLL_COUNT(Comparisons, 1);
+            return a->value < b->value;
+        };
+    };
+
+    // sorts chains of this list's nodes by value
+    using NodeSort = ChainSort<Node<T>, NodeLinks>;
+
+    // return the node at the specified index, which must exist; walks from
+    // whichever of the head, tail or cursor is closest, and leaves the
+    // cursor on the returned node
+    Node<T>* nodeAt(intmax_t idx);
+
+    // set the `prev` pointer of every node and the tail pointer by
+    // walking the `next` pointers from the head
+    void relinkPrev(void);
+
+    // compact the list if automatic compaction is on and the list is more
+    // fragmented than the threshold; called at the end of the sorts that
+    // relink nodes
+    void compactIfFragmented(void);
+
+    // put every value in the supplied buffer, separated by commas with 25
+    // values per line
+    void putValues(OutputBuffer& buffer);
+
+    // take the nodes of the supplied List, leaving it empty; with a pool
+    // allocator, the supplied List gets a new pool
+    void stealNodes(DoublyLinkedList& l);
+
     // swap the values stored in two nodes
-    void swapValues(Node* a, Node* b);
+    void swapValues(Node<T>* a, Node<T>* b);
 
     // increment length by 1
     void incrementLength(void);
@@ -80,15 +453,33 @@ private:
     void decrementLength(void);
 
     // a pointer to the first node in the list
-    Node* head;
+    Node<T>* head;
 
     // a pointer to the last node in the list
-    Node* tail;
+    Node<T>* tail;
 
     // the length of the list in number of values/nodes
     intmax_t length;
+
+    // the node reached by the most recent walk and its index; null when no
+    // walk has happened since the last change that moved nodes around
+    Node<T>* cursorNode;
+    intmax_t cursorIdx;
+
+    // allocator that every node of the list is taken from
+    NodeAllocator nodeAlloc;
+
+    // fragmentation above which the relinking sorts compact the list
+    double autoCompactThreshold;
 };
 
-std::ostream& operator<<(std::ostream& outStream, DoublyLinkedList& linkedList);
+template <typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& outStream, DoublyLinkedList<T, Allocator>& linkedList);
+
+// the definitions of the template's member functions
+#include "DoublyLinkedList.tpp"
+
+#endif
 
-#endif
\ No newline at end of file
+// views are returned by view(), so they are available wherever lists are
+#include "ListView.h"
@@ -0,0 +1,1607 @@
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <thread>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// every file written by save() starts with this header
+struct DoublyLinkedListFileHeader {
+    char magic[8];
+    uint64_t valueSize;
+    uint64_t length;
+};
+
+// the magic number that identifies a file written by save()
+static const char DOUBLY_LINKED_LIST_MAGIC[8]{'D', 'L', 'L', 'I', 'S', 'T', '0', '1'};
+
+// a link to a node that starts less than this many bytes after the end of
+// the node is counted as sequential by fragmentation(): one cache line
+static const uintptr_t SEQUENTIAL_LINK_GAP{64};
+
+// CONSTRUCTOR
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList()
+        : DoublyLinkedList(Allocator{}) {
+
+    /* constructor has an empty body */
+
+}
+
+// CONSTRUCTOR
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& alloc)
+        : head{nullptr}, tail{nullptr}, length{0},
+          cursorNode{nullptr}, cursorIdx{0}, nodeAlloc(alloc),
+          autoCompactThreshold{1.0} {
+
+    /* constructor has an empty body */
+
+}
+
+// CONSTRUCTOR
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const DoublyLinkedList& l,
+                                                 intmax_t startIdx, intmax_t len)
+        : head{nullptr}, tail{nullptr}, length{0},
+          cursorNode{nullptr}, cursorIdx{0},
+          nodeAlloc(NodeTraits::select_on_container_copy_construction(l.nodeAlloc)),
+          autoCompactThreshold{1.0} {
+
+    DLL_OPERATION(Construct);
+
+    // current node; start at the head of the list provided
+    Node<T>* currNode = l.head;
+
+    // move down the list until the node at index `startIdx` is reached
+    for (intmax_t i = 0; (i < startIdx) && (currNode != nullptr); i++) {
+        DLL_COUNT(NodesWalked, 1);
+        currNode = currNode->next;
+    }
+
+    // iterate through `len` nodes (or until the end of the list is
+    // reached) beginning at currNode
+    for (intmax_t i = 0; (i < len) && (currNode != nullptr); i++) {
+
+        // add the value of the current node being copied to the new list
+        append(currNode->value);
+
+        // move to the next node to copy
+        currNode = currNode->next;
+    }
+}
+
+// CONSTRUCTOR
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(DoublyLinkedList&& l) noexcept
+        : head{nullptr}, tail{nullptr}, length{0},
+          cursorNode{nullptr}, cursorIdx{0}, nodeAlloc(l.nodeAlloc),
+          autoCompactThreshold{l.autoCompactThreshold} {
+
+    // the nodes were allocated by an equal allocator, so they can simply
+    // be handed over
+    stealNodes(l);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::operator=(DoublyLinkedList&& l) {
+
+    // moving a list into itself leaves it as it is
+    if (this == &l) {
+        return *this;
+    }
+
+    // delete all of the elements of the calling List
+    clear();
+
+    // if the allocator moves with the nodes, take both
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+        nodeAlloc = l.nodeAlloc;
+        stealNodes(l);
+
+    // otherwise, the nodes can only be taken if they were allocated by an
+    // allocator equal to the calling List's; if not, move each value into
+    // a node taken from the calling List's allocator
+    } else {
+        if (nodeAlloc == l.nodeAlloc) {
+            stealNodes(l);
+        } else {
+            while (l.length > 0) {
+                emplace_back(l.popFront());
+            }
+        }
+    }
+
+    return *this;
+}
+
+// DESTRUCTOR
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+
+    DLL_OPERATION(Destroy);
+
+    // give every node back to the allocator
+    destroyAllNodes();
+
+    // set head and tail pointers to null
+    head = nullptr;
+    tail = nullptr;
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::popFront(void) {
+
+    DLL_OPERATION(PopFront);
+
+    // if there's nothing to pop throw an out of range error
+    if (length == 0) {
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // if there is only one element
+    if (length == 1) {
+
+        // move the value out of the only element
+        T v{std::move(head->value)};
+
+        // reset the list to empty state
+        clear();
+
+        // return the value
+        return v;
+    }
+
+    // store the location of the head node
+    Node<T>* nodeToPop = head;
+
+    // set the second node as the head node
+    head = head->next;
+
+    // set the `prev` pointer of the new head to null
+    head->prev = nullptr;
+
+    // every index after the old head moved down by one; if the cursor was
+    // on the old head, forget it
+    if (cursorNode == nodeToPop) {
+        cursorNode = nullptr;
+    } else {
+        cursorIdx--;
+    }
+
+    // remove `next` pointer from old head node
+    nodeToPop->next = nullptr;
+
+    // move the value out of the node and the delete it
+    T v{std::move(nodeToPop->value)};
+    destroyNode(nodeToPop);
+    nodeToPop = nullptr;
+
+    // decrement the length by one
+    decrementLength();
+
+    return v;
+}
+
+template <typename T, typename Allocator>
+T& DoublyLinkedList<T, Allocator>::at(int idx) {
+
+    DLL_OPERATION(At);
+
+    // if the specified index does not exist
+    if ((idx < 0) || (idx >= length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // return a reference to the value of the node at the index
+    return nodeAt(idx)->value;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::insertAt(int idx, T value) {
+
+    DLL_OPERATION(InsertAt);
+
+    // if the specified index is not within the list or just past its end
+    if ((idx < 0) || (idx > length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // inserting at either end of the list does not need a walk
+    if (idx == 0) {
+        emplace_front(std::move(value));
+        return;
+    }
+    if (idx == length) {
+        emplace_back(std::move(value));
+        return;
+    }
+
+    // the new node goes between the node at the index and the one before it
+    Node<T>* nextNode = nodeAt(idx);
+    Node<T>* newNode = createNode(std::move(value));
+
+    newNode->prev = nextNode->prev;
+    newNode->next = nextNode;
+    nextNode->prev->next = newNode;
+    nextNode->prev = newNode;
+
+    // the new node now holds the index the cursor was moved to
+    cursorNode = newNode;
+
+    // increment length
+    incrementLength();
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::eraseAt(int idx) {
+
+    DLL_OPERATION(EraseAt);
+
+    // if the specified index does not exist
+    if ((idx < 0) || (idx >= length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // removing the first node does not need a walk
+    if (idx == 0) {
+        return popFront();
+    }
+
+    // unlink the node at the index from its neighbours; it is not the head,
+    // so it always has a previous node
+    Node<T>* nodeToErase = nodeAt(idx);
+    nodeToErase->prev->next = nodeToErase->next;
+
+    if (nodeToErase == tail) {
+        tail = nodeToErase->prev;
+    } else {
+        nodeToErase->next->prev = nodeToErase->prev;
+    }
+
+    // leave the cursor on the node before the erased one
+    cursorNode = nodeToErase->prev;
+    cursorIdx = idx - 1;
+
+    // move the value out of the node and the delete it
+    T v{std::move(nodeToErase->value)};
+    destroyNode(nodeToErase);
+
+    // decrement the length by one
+    decrementLength();
+
+    return v;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& DoublyLinkedList<T, Allocator>::emplace_back(Args&&... args) {
+
+    DLL_OPERATION(Append);
+
+    // create the new node; its value is constructed in place
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
+
+    if (length == 0) {
+
+        // since this is also the head prev pointer is null
+        newNode->prev = nullptr;
+
+        // for a list of len 1, head and tail are the same
+        head = newNode;
+
+    } else {  // if the list's len > 0
+
+        // link the new node after the tail
+        tail->next = newNode;
+
+        // set new node's prev pointer to the current tail
+        newNode->prev = tail;
+    }
+
+    // set the new node as the tail of the list
+    tail = newNode;
+
+    // by nature, the tail does not have a next node
+    tail->next = nullptr;
+
+    // increment length
+    incrementLength();
+
+    return tail->value;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& DoublyLinkedList<T, Allocator>::emplace_front(Args&&... args) {
+
+    DLL_OPERATION(Prepend);
+
+    // create the new node; its value is constructed in place
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
+
+    if (length == 0) {
+
+        // since this node is also the tail, next ptr is null
+        newNode->next = nullptr;
+
+        // for a list of len 1, head and tail are the same
+        tail = newNode;
+
+    } else {  // if the list length > 0
+
+        // link the new node before the head
+        head->prev = newNode;
+
+        // link the new node to the current head
+        newNode->next = head;
+    }
+
+    // set the new node as the head of the list
+    head = newNode;
+
+    // by nature the head does not have a prev node
+    head->prev = nullptr;
+
+    // every index after the new head moved up by one
+    cursorIdx++;
+
+    // increment length
+    incrementLength();
+
+    return head->value;
+}
+
+template <typename T, typename Allocator>
+template <typename ForwardIt, typename>
+void DoublyLinkedList<T, Allocator>::append(ForwardIt first, ForwardIt last) {
+
+    DLL_OPERATION(AppendRange);
+
+    // the number of values decides how many nodes are taken at once
+    intmax_t n = std::distance(first, last);
+    if (n == 0) {
+        return;
+    }
+
+    // the length can only grow up to the largest value it can hold; the
+    // check is done once for the whole range
+    if (length > INTMAX_MAX - n) {
+        throw std::overflow_error{"DoublyLinkedList length exceeded max"};
+    }
+
+    // build a chain holding a copy of every value, then link it after the tail
+    Node<T>* chainLast;
+    Node<T>* chainFirst = createChain(n, [&](T* value) {
+        NodeTraits::construct(nodeAlloc, value, *first);
+        ++first;
+    }, false, chainLast);
+
+    linkChain(nullptr, chainFirst, chainLast, n);
+}
+
+template <typename T, typename Allocator>
+template <typename ForwardIt, typename>
+void DoublyLinkedList<T, Allocator>::prepend_range(ForwardIt first, ForwardIt last) {
+
+    DLL_OPERATION(PrependRange);
+
+    // the number of values decides how many nodes are taken at once
+    intmax_t n = std::distance(first, last);
+    if (n == 0) {
+        return;
+    }
+
+    // the length can only grow up to the largest value it can hold; the
+    // check is done once for the whole range
+    if (length > INTMAX_MAX - n) {
+        throw std::overflow_error{"DoublyLinkedList length exceeded max"};
+    }
+
+    // build a chain holding a copy of every value, then link it before the head
+    Node<T>* chainLast;
+    Node<T>* chainFirst = createChain(n, [&](T* value) {
+        NodeTraits::construct(nodeAlloc, value, *first);
+        ++first;
+    }, false, chainLast);
+
+    linkChain(head, chainFirst, chainLast, n);
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::assign(intmax_t n, const T& value) {
+
+    DLL_OPERATION(Assign);
+
+    // a negative number of values cannot be assigned
+    if (n < 0) {
+        throw std::out_of_range{"list length cannot be negative"};
+    }
+
+    // remove the old values first, so their nodes can be used again
+    clear();
+
+    if (n == 0) {
+        return;
+    }
+
+    Node<T>* chainLast;
+    Node<T>* chainFirst = createChain(n, [&](T* newValue) {
+        NodeTraits::construct(nodeAlloc, newValue, value);
+    }, false, chainLast);
+
+    linkChain(nullptr, chainFirst, chainLast, n);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename DoublyLinkedList<T, Allocator>::iterator
+DoublyLinkedList<T, Allocator>::emplace(const_iterator pos, Args&&... args) {
+
+    DLL_OPERATION(Insert);
+
+    // adding before the end iterator or the head is an append or prepend
+    if (pos.node == nullptr) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator{tail, this};
+    }
+    if (pos.node == head) {
+        emplace_front(std::forward<Args>(args)...);
+        return iterator{head, this};
+    }
+
+    // the new node goes between the node the iterator refers to and the
+    // one before it
+    Node<T>* nextNode = pos.node;
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
+
+    newNode->prev = nextNode->prev;
+    newNode->next = nextNode;
+    nextNode->prev->next = newNode;
+    nextNode->prev = newNode;
+
+    // the index of the new node is not known, so forget the cursor
+    cursorNode = nullptr;
+
+    // increment length
+    incrementLength();
+
+    return iterator{newNode, this};
+}
+
+template <typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::iterator
+DoublyLinkedList<T, Allocator>::erase(const_iterator pos) {
+
+    DLL_OPERATION(Erase);
+
+    Node<T>* nodeToErase = pos.node;
+    Node<T>* nextNode = nodeToErase->next;
+
+    // unlink the node from the node before it, or from the head pointer
+    if (nodeToErase == head) {
+        head = nextNode;
+    } else {
+        nodeToErase->prev->next = nextNode;
+    }
+
+    // unlink the node from the node after it, or from the tail pointer
+    if (nodeToErase == tail) {
+        tail = nodeToErase->prev;
+    } else {
+        nextNode->prev = nodeToErase->prev;
+    }
+
+    // the index of the erased node is not known, so forget the cursor
+    cursorNode = nullptr;
+
+    // free the node and decrement the length by one
+    destroyNode(nodeToErase);
+    decrementLength();
+
+    return iterator{nextNode, this};
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::concatenate(const DoublyLinkedList& rightList) {
+
+    DLL_OPERATION(Concatenate);
+
+    // start at the head of the list supplied in the function call
+    Node<T>* currNode = rightList.head;
+
+    // iterate through each node in the supplied List
+    while (currNode != nullptr) {
+
+        // create a new node in the calling List with the value of currNode
+        // from the supplied List
+        append(currNode->value);
+
+        // move to the next mode in the supplied List
+        currNode = currNode->next;
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::splice(DoublyLinkedList& rightList) {
+
+    DLL_OPERATION(Splice);
+
+    // a List cannot be spliced onto itself, and an empty List adds nothing
+    if ((this == &rightList) || (rightList.length == 0)) {
+        return;
+    }
+
+    // if the nodes of the supplied List did not come from an equal
+    // allocator, the calling List can only take them if it can also take
+    // the memory they live in
+    if (!(nodeAlloc == rightList.nodeAlloc)) {
+
+        bool adopted = false;
+
+        if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+            // a pool that has never handed out a node does not know its
+            // block size yet, and could not take blocks of any size
+            NodePool& pool = nodeAlloc.getPool();
+            if (rightList.nodeAlloc.ownsPoolAlone() &&
+                pool.bind(sizeof(Node<T>), alignof(Node<T>))) {
+                adopted = pool.adopt(rightList.nodeAlloc.getPool());
+            }
+        }
+
+        // move each value into a node of the calling List instead
+        if (!adopted) {
+            while (rightList.length > 0) {
+                emplace_back(rightList.popFront());
+            }
+            return;
+        }
+    }
+
+    // if the value of length would overflow, throw an error
+    if (length > INTMAX_MAX - rightList.length) {
+        throw std::overflow_error{"DoublyLinkedList length exceeded "
+                                  "max"};
+    }
+
+    // link the supplied List's chain after the tail of the calling List
+    if (length == 0) {
+        head = rightList.head;
+    } else {
+        tail->next = rightList.head;
+        rightList.head->prev = tail;
+    }
+    tail = rightList.tail;
+    length += rightList.length;
+
+    // leave the supplied List empty
+    rightList.head = nullptr;
+    rightList.tail = nullptr;
+    rightList.length = 0;
+    rightList.cursorNode = nullptr;
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator> DoublyLinkedList<T, Allocator>::split(int idx) {
+
+    DLL_OPERATION(Split);
+
+    // if the specified index is not within the list or just past its end
+    if ((idx < 0) || (idx > length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // the new List uses an allocator equal to the calling List's, so it
+    // can free the nodes it is given
+    DoublyLinkedList rightList{Allocator(nodeAlloc)};
+
+    // splitting at the end leaves nothing to detach
+    if (idx == length) {
+        return rightList;
+    }
+
+    // splitting at the start detaches every node
+    if (idx == 0) {
+        rightList.stealNodes(*this);
+        return rightList;
+    }
+
+    // find the first node to detach; it is not the head, so it always
+    // has a previous node
+    Node<T>* first = nodeAt(idx);
+
+    // the detached nodes become the new List
+    rightList.head = first;
+    rightList.tail = tail;
+    rightList.length = length - idx;
+
+    // the node before the first detached node becomes the tail
+    tail = first->prev;
+    tail->next = nullptr;
+    first->prev = nullptr;
+    length = idx;
+
+    // the cursor was left on a node that now belongs to the new List
+    cursorNode = nullptr;
+
+    return rightList;
+}
+
+template <typename T, typename Allocator>
+ListView<T, Allocator> DoublyLinkedList<T, Allocator>::view(intmax_t startIdx, intmax_t len) {
+
+    // if the specified range does not begin inside the list, or has a
+    // negative length
+    if ((startIdx < 0) || (len < 0) || (startIdx > length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // a view that runs past the end of the list stops at the tail
+    if (len > length - startIdx) {
+        len = length - startIdx;
+    }
+
+    // an empty view does not refer to any node
+    if (len == 0) {
+        return ListView<T, Allocator>{this, nullptr, 0};
+    }
+
+    return ListView<T, Allocator>{this, nodeAt(startIdx), len};
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::clear(void) {
+
+    DLL_OPERATION(Clear);
+
+    // give every node back to the allocator
+    destroyAllNodes();
+
+    // set head and tail pointers to null
+    head = nullptr;
+    tail = nullptr;
+
+    // the node the cursor was on no longer exists
+    cursorNode = nullptr;
+
+    // reset length to 0
+    length = 0;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::compact(void) {
+
+    DLL_OPERATION(Compact);
+
+    // if there are no nodes, there is nothing to move
+    if (length == 0) {
+        return;
+    }
+
+    // with a node pool, the new nodes are one block of `length` nodes;
+    // otherwise each is taken from the allocator, all before any old node
+    // is freed, so the allocator hands out fresh memory one after another;
+    // each value is moved into its new node, or copied if moving could
+    // throw, so the old chain is intact if building the new one fails
+    Node<T>* currNode = head;
+    Node<T>* newTail;
+    Node<T>* newHead = createChain(length, [&](T* value) {
+        NodeTraits::construct(nodeAlloc, value, std::move_if_noexcept(currNode->value));
+        currNode = currNode->next;
+    }, true, newTail);
+
+    // switch the list over to the new chain, then free the old one
+    Node<T>* oldHead = head;
+    head = newHead;
+    tail = newTail;
+    cursorNode = nullptr;
+
+    // if this list is the only user of its node pool, every block outside
+    // the new slab belongs to the old chain, so those slabs can be returned
+    // to the heap at once; values that need destroying are visited first
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        NodePool& pool = nodeAlloc.getPool();
+        if (nodeAlloc.ownsPoolAlone() && pool.bind(sizeof(Node<T>), alignof(Node<T>))) {
+
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (Node<T>* oldNode = oldHead; oldNode != nullptr; oldNode = oldNode->next) {
+                    NodeTraits::destroy(nodeAlloc, std::addressof(oldNode->value));
+                }
+            }
+
+            pool.releaseOtherSlabs(head);
+            DLL_COUNT(NodesFreed, length);
+            return;
+        }
+    }
+
+    while (oldHead != nullptr) {
+        Node<T>* nextNode = oldHead->next;
+        destroyNode(oldHead);
+        oldHead = nextNode;
+    }
+}
+
+template <typename T, typename Allocator>
+double DoublyLinkedList<T, Allocator>::fragmentation(void) const {
+
+    // a list of fewer than two values has no links
+    if (length < 2) {
+        return 0;
+    }
+
+    // count the links that do not lead forward to a node that starts
+    // within a cache line of the end of the node; the heap puts a header
+    // between blocks, so with most allocators the next node is not exactly
+    // at the end of this one even when they were allocated one after another
+    intmax_t scattered = 0;
+
+    for (Node<T>* currNode = head; currNode->next != nullptr; currNode = currNode->next) {
+
+        uintptr_t end = reinterpret_cast<uintptr_t>(currNode) + sizeof(Node<T>);
+        uintptr_t next = reinterpret_cast<uintptr_t>(currNode->next);
+
+        if ((next < end) || ((next - end) >= SEQUENTIAL_LINK_GAP)) {
+            scattered++;
+        }
+    }
+
+    DLL_COUNT(NodesWalked, length);
+
+    return static_cast<double>(scattered) / static_cast<double>(length - 1);
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::bubbleSort(void) {
+
+    DLL_OPERATION(BubbleSort);
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // holder for the current working node
+    Node<T>* currNode;
+
+    // remains true if the list is sorted; otherwise, changed to false
+    bool sorted = false;
+
+    while (!sorted) {
+
+        // if no values are swapped after an iteration through the list, it is sorted
+        sorted = true;
+
+        // start at the head of the list
+        currNode = head;
+
+        while (currNode->next != nullptr) {
+
+            DLL_COUNT(Comparisons, 1);
+
+            // if the current and next value are out of order
+            if (currNode->next->value < currNode->value) {
+
+                // swap the values of the current and next node
+                swapValues(currNode, currNode->next);
+                DLL_COUNT(Swaps, 1);
+
+                // set sorted to false
+                sorted = false;
+            }
+
+            // move to the next node
+            currNode = currNode->next;
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::mergeSort(void) {
+
+    DLL_OPERATION(MergeSort);
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // sort the chain of nodes by rewriting the links between them; the
+    // sort links every node but the head back to the node before it
+    ValueLess less{};
+    head = NodeSort::sort(head, tail, less);
+    head->prev = nullptr;
+
+    // the node the cursor was on has most likely moved to another index
+    cursorNode = nullptr;
+
+    // walking the sorted list now jumps around memory; compact it if asked
+    compactIfFragmented();
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::parallelMergeSort(unsigned threadCount) {
+
+    DLL_OPERATION(ParallelMergeSort);
+
+    // each thread is given at least this many nodes; for shorter lists,
+    // starting threads costs more than it saves
+    const intmax_t MIN_SEGMENT_LENGTH{16'384};
+
+    // use one thread per hardware thread if no count was given
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    // number of segments the chain is cut into; one per thread
+    intmax_t segmentCount = length / MIN_SEGMENT_LENGTH;
+    if (segmentCount > static_cast<intmax_t>(threadCount)) {
+        segmentCount = threadCount;
+    }
+
+    // if only one thread would be used, sort on the calling thread
+    if (segmentCount < 2) {
+        mergeSort();
+        return;
+    }
+
+    // first and last node of each segment
+    std::vector<Node<T>*> segFirst(segmentCount);
+    std::vector<Node<T>*> segLast(segmentCount);
+
+    // threads started by the calling thread; room is made for all of them
+    // before the chain is cut, so that starting a thread is the only step
+    // that can fail after that
+    std::vector<std::thread> workers;
+    workers.reserve(segmentCount);
+
+    // run a task on a new thread; if no thread can be started (e.g. the
+    // limit on threads has been reached), run it on the calling thread
+    // instead, so the segments are still sorted and merged and the list
+    // is left whole
+    auto startWorker = [&workers](auto task) {
+        try {
+            workers.emplace_back(task);
+        } catch (const std::system_error&) {
+            task();
+        }
+    };
+
+    // cut the chain into segments of (nearly) equal length in one walk
+    Node<T>* currNode = head;
+    for (intmax_t i = 0; i < segmentCount; i++) {
+
+        // the earlier segments take one extra node each when the length
+        // does not divide evenly
+        intmax_t segLength = (length / segmentCount) + ((i < length % segmentCount) ? 1 : 0);
+
+        segFirst[i] = currNode;
+        for (intmax_t j = 1; j < segLength; j++) {
+            currNode = currNode->next;
+        }
+        segLast[i] = currNode;
+
+        currNode = currNode->next;
+        segLast[i]->next = nullptr;
+    }
+
+    // sort every segment at the same time; the calling thread sorts the
+    // first segment itself
+    for (intmax_t i = 1; i < segmentCount; i++) {
+        startWorker([&segFirst, &segLast, i] {
+            DLL_WORKER(ParallelMergeSort);
+            ValueLess less{};
+            segFirst[i] = NodeSort::sort(segFirst[i], segLast[i], less);
+        });
+    }
+    ValueLess less{};
+    segFirst[0] = NodeSort::sort(segFirst[0], segLast[0], less);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // merge neighbouring segments in pairs until one is left; the pairs of
+    // a round are merged at the same time, and the left segment of a pair
+    // always holds the earlier values, so the sort stays stable
+    for (intmax_t step = 1; step < segmentCount; step *= 2) {
+
+        workers.clear();
+
+        for (intmax_t i = step; i < segmentCount; i += 2 * step) {
+
+            // segment `i - step` absorbs segment `i`
+            intmax_t left = i - step;
+            auto mergePair = [&segFirst, &segLast, left, i] {
+                DLL_WORKER(ParallelMergeSort);
+                ValueLess less{};
+                segFirst[left] = NodeSort::merge(segFirst[left], segLast[left],
+                                                 segFirst[i], segLast[i], segLast[left], less);
+            };
+
+            // the calling thread merges the last pair of the round itself
+            if (i + 2 * step >= segmentCount) {
+                mergePair();
+            } else {
+                startWorker(mergePair);
+            }
+        }
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // restore the `prev` pointers and the tail pointer of the sorted chain
+    head = segFirst[0];
+    relinkPrev();
+
+    // the node the cursor was on has most likely moved to another index
+    cursorNode = nullptr;
+
+    // walking the sorted list now jumps around memory; compact it if asked
+    compactIfFragmented();
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::radixSort(void) {
+
+    DLL_OPERATION(RadixSort);
+
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                  "radixSort can only sort lists of integers");
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // values are sorted as unsigned keys; flipping the sign bit of a signed
+    // value puts negative values before positive ones
+    using Key = std::make_unsigned_t<T>;
+    const int KEY_BYTES{sizeof(Key)};
+    const Key SIGN_BIT = std::is_signed_v<T> ? (Key{1} << (8 * KEY_BYTES - 1)) : Key{0};
+
+    // copy the keys of the list into a contiguous buffer and count how
+    // often each value of each byte appears, all in one pass
+    std::vector<Key> keys(length);
+    std::vector<Key> buffer(length);
+    std::vector<std::size_t> counts(KEY_BYTES * 256, 0);
+
+    intmax_t k = 0;
+    for (Node<T>* currNode = head; currNode != nullptr; currNode = currNode->next) {
+
+        Key key = static_cast<Key>(currNode->value) ^ SIGN_BIT;
+        keys[k++] = key;
+
+        for (int byte = 0; byte < KEY_BYTES; byte++) {
+            counts[(byte * 256) + ((key >> (8 * byte)) & 0xFF)]++;
+        }
+    }
+
+    // sort the keys by each byte, least significant first; each pass is
+    // stable, so the order from the earlier passes is kept within a byte
+    for (int byte = 0; byte < KEY_BYTES; byte++) {
+
+        std::size_t* byteCounts = &counts[byte * 256];
+
+        // if every key has the same value for this byte, the pass would
+        // not change the order
+        if (byteCounts[(keys[0] >> (8 * byte)) & 0xFF] == static_cast<std::size_t>(length)) {
+            continue;
+        }
+
+        // turn the counts into the position of the first key with each value
+        std::size_t position = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            std::size_t count = byteCounts[digit];
+            byteCounts[digit] = position;
+            position += count;
+        }
+
+        // move every key to its position for this byte
+        for (Key key : keys) {
+            buffer[byteCounts[(key >> (8 * byte)) & 0xFF]++] = key;
+        }
+
+        keys.swap(buffer);
+    }
+
+    // write the sorted values back into the nodes in one pass
+    k = 0;
+    for (Node<T>* currNode = head; currNode != nullptr; currNode = currNode->next) {
+        currNode->value = static_cast<T>(keys[k++] ^ SIGN_BIT);
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::copyMergeSort(void) {
+
+    DLL_OPERATION(CopyMergeSort);
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // copy the List into a right and left half
+    DoublyLinkedList right{*this, 0, length / 2};
+    DoublyLinkedList left{*this, length / 2, length - (length / 2)};
+
+    // clear all of the values from the calling List
+    clear();
+
+    // call merge sort on each half of the list
+    right.copyMergeSort();
+    left.copyMergeSort();
+
+    // while both the right and left list have elements
+    while (right.getLength() && left.getLength()) {
+
+        DLL_COUNT(Comparisons, 1);
+
+        // pops values from right and left into the calling List
+        // in sorted order
+        if (!(left.at(0) < right.at(0))) {
+            append(right.popFront());
+        } else {
+            append(left.popFront());
+        }
+    }
+
+    // when one of the right or left list has been emptied, the
+    // other can just be concatenated to the end of the calling List
+    if (right.getLength()) {
+        concatenate(right);
+    } else {
+        concatenate(left);
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::writeTo(int fd) {
+
+    DLL_OPERATION(Print);
+
+    // the values are formatted into a buffer, which is written to the file
+    // descriptor each time it fills up
+    OutputBuffer buffer{fd};
+    putValues(buffer);
+    buffer.flush();
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::save(const std::string& path) const {
+
+    DLL_OPERATION(Save);
+
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "only lists of trivially copyable values can be saved");
+
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::system_error{errno, std::generic_category(), "could not open " + path};
+    }
+
+    try {
+
+        // the header, then the bytes of every value in order, written in
+        // large blocks through a buffer
+        OutputBuffer buffer{fd};
+
+        DoublyLinkedListFileHeader header{};
+        std::memcpy(header.magic, DOUBLY_LINKED_LIST_MAGIC, sizeof(header.magic));
+        header.valueSize = sizeof(T);
+        header.length = length;
+        buffer.put(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (Node<T>* currNode = head; currNode != nullptr; currNode = currNode->next) {
+            buffer.put(reinterpret_cast<const char*>(&currNode->value), sizeof(T));
+        }
+
+        buffer.flush();
+
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+
+    if (close(fd) != 0) {
+        throw std::system_error{errno, std::generic_category(), "could not write " + path};
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::load(const std::string& path) {
+
+    DLL_OPERATION(Load);
+
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "only lists of trivially copyable values can be loaded");
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::system_error{errno, std::generic_category(), "could not open " + path};
+    }
+
+    // the size of the file decides how much of it to map
+    struct stat fileStat{};
+    if (fstat(fd, &fileStat) != 0) {
+        int error = errno;
+        close(fd);
+        throw std::system_error{error, std::generic_category(), "could not read " + path};
+    }
+    std::size_t fileSize = fileStat.st_size;
+
+    if (fileSize < sizeof(DoublyLinkedListFileHeader)) {
+        close(fd);
+        throw std::runtime_error{path + " is not a saved list"};
+    }
+
+    // map the whole file; the mapping stays valid after the file is closed
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    int error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::system_error{error, std::generic_category(), "could not map " + path};
+    }
+
+    // the values are read once from start to end
+    madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+    try {
+
+        const unsigned char* bytes = static_cast<const unsigned char*>(mapping);
+
+        // check that the file was saved from a list of the same value type
+        // and holds exactly as many values as its header says
+        DoublyLinkedListFileHeader header{};
+        std::memcpy(&header, bytes, sizeof(header));
+
+        if ((std::memcmp(header.magic, DOUBLY_LINKED_LIST_MAGIC, sizeof(header.magic)) != 0) ||
+            (header.valueSize != sizeof(T)) ||
+            (header.length > (fileSize - sizeof(header)) / sizeof(T)) ||
+            (fileSize - sizeof(header) != header.length * sizeof(T))) {
+            throw std::runtime_error{path + " is not a saved list of this value type"};
+        }
+
+        if (header.length > static_cast<uint64_t>(INTMAX_MAX)) {
+            throw std::overflow_error{"DoublyLinkedList length exceeded max"};
+        }
+
+        // remove the old values of the list
+        clear();
+
+        // build the chain from the mapped values in one sequential pass,
+        // as append(first, last) does; if it fails the list is left empty
+        const unsigned char* value = bytes + sizeof(header);
+        intmax_t n = static_cast<intmax_t>(header.length);
+
+        if (n > 0) {
+            Node<T>* chainLast;
+            Node<T>* chainFirst = createChain(n, [&](T* newValue) {
+                std::memcpy(static_cast<void*>(newValue), value, sizeof(T));
+                value += sizeof(T);
+            }, false, chainLast);
+
+            linkChain(nullptr, chainFirst, chainLast, n);
+        }
+
+    } catch (...) {
+        munmap(mapping, fileSize);
+        throw;
+    }
+
+    munmap(mapping, fileSize);
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::relinkPrev(void) {
+
+    // the first node does not have a previous node
+    head->prev = nullptr;
+
+    // current node; start at the head of the list
+    Node<T>* currNode = head;
+
+    // point each node back at the node before it
+    while (currNode->next != nullptr) {
+        currNode->next->prev = currNode;
+        currNode = currNode->next;
+    }
+
+    // the last node reached is the tail of the list
+    tail = currNode;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::compactIfFragmented(void) {
+
+    // a threshold of 1 or more can never be passed, so the walk that
+    // measures fragmentation is skipped
+    if ((autoCompactThreshold < 1.0) && (fragmentation() > autoCompactThreshold)) {
+        compact();
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::putValues(OutputBuffer& buffer) {
+
+    // number of values put in the buffer so far
+    intmax_t printed = 0;
+
+    for (Node<T>* currNode = head; currNode != nullptr; currNode = currNode->next) {
+
+        // every value but the first is preceded by a comma
+        if (printed > 0) {
+            buffer.put(", ", 2);
+
+            // print 25 values per line
+            if ((printed % 25) == 0) {
+                buffer.put("\n", 1);
+            }
+        }
+
+        buffer.put(currNode->value);
+        printed++;
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::stealNodes(DoublyLinkedList& l) {
+
+    // take the supplied List's chain of nodes and its cursor
+    head = l.head;
+    tail = l.tail;
+    length = l.length;
+    cursorNode = l.cursorNode;
+    cursorIdx = l.cursorIdx;
+
+    // leave the supplied List empty
+    l.head = nullptr;
+    l.tail = nullptr;
+    l.length = 0;
+    l.cursorNode = nullptr;
+
+    // the supplied List has no nodes left in its pool, so it is given a
+    // new pool of its own; the calling List can then be the only user of
+    // the pool its nodes came from, and free them all at once; if the new
+    // pool cannot be allocated, the two Lists go on sharing
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        try {
+            l.nodeAlloc = NodeAllocator{};
+        } catch (const std::bad_alloc&) {
+            /* sharing the pool is still correct, only slower to clear */
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::swapValues(Node<T>* a, Node<T>* b) {
+
+    // exchange the values of the two nodes; std::swap moves rather than
+    // copies when it can
+    using std::swap;
+    swap(a->value, b->value);
+}
+
+template <typename T, typename Allocator>
+Node<T>* DoublyLinkedList<T, Allocator>::allocateNodeBlock(intmax_t n) {
+
+    // only a node pool can hand out many nodes at once that can still be
+    // given back one at a time
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        NodePool& pool = nodeAlloc.getPool();
+        if (pool.bind(sizeof(Node<T>), alignof(Node<T>))) {
+            return static_cast<Node<T>*>(pool.allocateContiguous(n));
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename T, typename Allocator>
+Node<T>* DoublyLinkedList<T, Allocator>::allocateNodeRun(intmax_t n, intmax_t& count) {
+
+    // a node pool hands out the unused blocks of its slabs in order
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        NodePool& pool = nodeAlloc.getPool();
+        if (pool.bind(sizeof(Node<T>), alignof(Node<T>))) {
+            std::size_t runLength;
+            Node<T>* run = static_cast<Node<T>*>(pool.allocateRun(n, runLength));
+            count = runLength;
+            return run;
+        }
+    }
+
+    count = 0;
+    return nullptr;
+}
+
+template <typename T, typename Allocator>
+template <typename Construct>
+Node<T>* DoublyLinkedList<T, Allocator>::createChain(intmax_t n, Construct construct,
+                                                    bool oneBlock, Node<T>*& last) {
+
+    // nodes that follow one another in memory and have not been used yet:
+    // all `n` nodes at once if asked to, otherwise runs of the node pool's
+    // slabs; with other allocators each node is allocated on its own
+    intmax_t runLeft = 0;
+    Node<T>* run = oneBlock ? allocateNodeBlock(n) : nullptr;
+    if (run != nullptr) {
+        runLeft = n;
+    }
+
+    // the chain built so far, and the number of nodes in it; `link` is the
+    // pointer the next node is stored in
+    Node<T>* first = nullptr;
+    Node<T>** link = &first;
+    last = nullptr;
+    intmax_t built = 0;
+
+    try {
+
+        while (built < n) {
+
+            // take the next run of nodes once the current one is used up;
+            // without one, a single node is taken from the allocator
+            if (runLeft == 0) {
+                run = allocateNodeRun(n - built, runLeft);
+            }
+            if (runLeft == 0) {
+                run = NodeTraits::allocate(nodeAlloc, 1);
+                runLeft = 1;
+            }
+
+            // construct and link every node of the run in one tight loop
+            for (; runLeft > 0; runLeft--, run++) {
+
+                // construct the value; if that fails the node is not part of
+                // the chain yet, and is given back with the rest of the run
+                construct(std::addressof(run->value));
+
+                // link the node after the last node of the chain
+                run->prev = last;
+                *link = run;
+                link = &run->next;
+                last = run;
+                built++;
+            }
+        }
+
+    } catch (...) {
+
+        // destroy the nodes built so far, give back the nodes of the run
+        // that were never used, and leave the list as it was
+        for (intmax_t i = 0; i < built; i++) {
+            Node<T>* nextNode = first->next;
+            NodeTraits::destroy(nodeAlloc, std::addressof(first->value));
+            NodeTraits::deallocate(nodeAlloc, first, 1);
+            first = nextNode;
+        }
+        for (intmax_t i = 0; i < runLeft; i++) {
+            NodeTraits::deallocate(nodeAlloc, run + i, 1);
+        }
+        throw;
+    }
+
+    // the last node ends the chain
+    last->next = nullptr;
+
+    DLL_COUNT(NodesAllocated, n);
+
+    return first;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::linkChain(Node<T>* before, Node<T>* first,
+                                               Node<T>* last, intmax_t n) {
+
+    // the node the chain goes after; the tail when linking at the end
+    Node<T>* after = (before == nullptr) ? tail : before->prev;
+
+    first->prev = after;
+    last->next = before;
+
+    if (after == nullptr) {
+        head = first;
+    } else {
+        after->next = first;
+    }
+
+    if (before == nullptr) {
+        tail = last;
+    } else {
+        before->prev = last;
+    }
+
+    // the nodes after the chain moved back by `n`; if the chain went in
+    // front of the head, that includes the cursor's node, and otherwise
+    // it is not known whether it does
+    if (before != nullptr) {
+        if (after == nullptr) {
+            cursorIdx += n;
+        } else {
+            cursorNode = nullptr;
+        }
+    }
+
+    // the length is updated once for the whole chain
+    length += n;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+Node<T>* DoublyLinkedList<T, Allocator>::createNode(Args&&... args) {
+
+    // take memory for the node from the allocator
+    Node<T>* node = NodeTraits::allocate(nodeAlloc, 1);
+
+    // construct the value in place; if that fails, give the memory back
+    try {
+        NodeTraits::construct(nodeAlloc, std::addressof(node->value),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(nodeAlloc, node, 1);
+        throw;
+    }
+
+    DLL_COUNT(NodesAllocated, 1);
+
+    return node;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node<T>* node) {
+
+    // destroy the value, then hand the node back to the allocator
+    NodeTraits::destroy(nodeAlloc, std::addressof(node->value));
+    NodeTraits::deallocate(nodeAlloc, node, 1);
+
+    DLL_COUNT(NodesFreed, 1);
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyAllNodes(void) {
+
+    // if this list is the only user of its node pool, every block the pool
+    // has handed out is one of this list's nodes, so the pool can be reset
+    // in one step; values that need destroying are still visited first
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        if (nodeAlloc.ownsPoolAlone()) {
+
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (Node<T>* currNode = head; currNode != nullptr; currNode = currNode->next) {
+                    NodeTraits::destroy(nodeAlloc, std::addressof(currNode->value));
+                }
+            }
+
+            nodeAlloc.getPool().reset();
+            DLL_COUNT(NodesFreed, length);
+            return;
+        }
+    }
+
+    // current node; start at the first node of the list
+    Node<T>* currNode = head;
+
+    while (currNode != nullptr) {
+
+        // store the address of the next node
+        Node<T>* nextNode = currNode->next;
+
+        // free the memory associated with the current node
+        destroyNode(currNode);
+
+        // move to the next node
+        currNode = nextNode;
+    }
+}
+
+template <typename T, typename Allocator>
+Node<T>* DoublyLinkedList<T, Allocator>::nodeAt(intmax_t idx) {
+
+    // start at the head, the tail, or the node last reached by a walk,
+    // whichever is the fewest nodes away from the index
+    Node<T>* currNode = head;
+    intmax_t currIdx = 0;
+
+    if ((length - 1 - idx) < idx) {
+        currNode = tail;
+        currIdx = length - 1;
+    }
+
+    if ((cursorNode != nullptr) &&
+        (std::abs(cursorIdx - idx) < std::abs(currIdx - idx))) {
+        currNode = cursorNode;
+        currIdx = cursorIdx;
+    }
+
+    DLL_COUNT(NodesWalked, std::abs(currIdx - idx));
+
+    // walk forward or backward until the desired node is reached
+    while (currIdx < idx) {
+        currNode = currNode->next;
+        currIdx++;
+    }
+    while (currIdx > idx) {
+        currNode = currNode->prev;
+        currIdx--;
+    }
+
+    // remember where the walk ended so the next walk can start there
+    cursorNode = currNode;
+    cursorIdx = currIdx;
+
+    return currNode;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::incrementLength(void) {
+
+    // if the value of length will overflow upon being incremented
+    if (length == INTMAX_MAX) {
+
+        // throw an error
+        throw std::overflow_error{"DoublyLinkedList length exceeded "
+                                  "max"};
+
+    } else {
+
+        // increment length
+        length++;
+    }
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::decrementLength(void) {
+
+    // if the list already has no elements
+    if (length == 0) {
+
+        // throw and error
+        throw std::underflow_error{"DoublyLinkedList length cannot be"
+                                   "shortened below zero"};
+
+    } else {
+
+        // decrement length
+        length--;
+    }
+
+}
+
+template <typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& outStream, DoublyLinkedList<T, Allocator>& linkedList) {
+
+    DLL_OPERATION(Print);
+
+    // the values are formatted into a buffer, which is sent to the stream
+    // in large blocks rather than one value at a time
+    OutputBuffer buffer{outStream};
+    linkedList.putValues(buffer);
+    buffer.flush();
+
+    return outStream;
+}
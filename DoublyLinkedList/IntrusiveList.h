@@ -0,0 +1,228 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "ChainSort.h"
+
+// a List Hook holds the links that put an object in an IntrusiveList;
+// objects that can be put in a list derive from it, so the links live
+// inside the object instead of in a separately allocated node;
+// an object can be in at most one list at a time, and must be removed
+// from its list before it is destroyed
+class ListHook {
+
+    // the list reads and rewrites the links
+    template <typename T>
+    friend class IntrusiveList;
+
+public:
+
+    // constructor method for an object that is not in a list
+    ListHook(void) : prev{nullptr}, next{nullptr} {};
+
+    // copying an object does not copy its place in a list; the copy starts
+    // out in no list, and assigning to an object leaves it where it is
+    ListHook(const ListHook&) : prev{nullptr}, next{nullptr} {};
+    ListHook& operator=(const ListHook&) { return *this; };
+
+    // return true if the object is in a list
+    bool isLinked(void) const { return next != nullptr; };
+
+private:
+
+    // the hooks of the objects before and after this one; both are null
+    // when the object is not in a list
+    ListHook* prev;
+    ListHook* next;
+};
+
+// an Intrusive List is a doubly-linked list of objects that already exist
+// somewhere else; the list links the objects' own hooks together, so it
+// never allocates or frees memory, and reaching an object from its link
+// takes no extra pointer to follow;
+// the list is circular around a hook of its own, which is both the node
+// before the first object and the node after the last one, so linking and
+// unlinking never have to check for the ends of the list;
+// T must derive from ListHook; the list does not own its objects
+template <typename T>
+class IntrusiveList {
+
+    static_assert(std::is_base_of_v<ListHook, T>,
+                  "objects of an IntrusiveList must derive from ListHook");
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them; an object can only be in one list,
+    // so a list cannot be copied
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    // bidirectional iterator over the objects of the list; `IsConst`
+    // selects whether the objects can be changed through the iterator
+    template <bool IsConst>
+    class ListIterator {
+
+        // the list creates iterators from its hooks
+        friend class IntrusiveList;
+
+        // a const iterator can be made from a non-const one
+        friend class ListIterator<!IsConst>;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        // constructor method for an iterator that does not refer to a list
+        ListIterator(void) : hook{nullptr} {};
+
+        // constructor method to make a const iterator from a non-const one
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        ListIterator(const ListIterator<OtherConst>& other) : hook{other.hook} {}
+
+        reference operator*(void) const { return *static_cast<pointer>(hook); };
+        pointer operator->(void) const { return static_cast<pointer>(hook); };
+
+        // move to the next or previous object; the list's own hook is the
+        // end of the list, so no special cases are needed
+        ListIterator& operator++(void) { hook = hook->next; return *this; };
+        ListIterator operator++(int) { ListIterator old{*this}; hook = hook->next; return old; };
+        ListIterator& operator--(void) { hook = hook->prev; return *this; };
+        ListIterator operator--(int) { ListIterator old{*this}; hook = hook->prev; return old; };
+
+        bool operator==(const ListIterator& other) const { return hook == other.hook; };
+        bool operator!=(const ListIterator& other) const { return hook != other.hook; };
+
+    private:
+
+        // constructor method for an iterator at the supplied hook
+        explicit ListIterator(ListHook* hook) : hook{hook} {};
+
+        // the hook of the object the iterator refers to
+        ListHook* hook;
+    };
+
+public:
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = ListIterator<false>;
+    using const_iterator = ListIterator<true>;
+
+    // constructor method for an empty list
+    IntrusiveList(void);
+
+    // move constructor method takes the objects of the supplied List in
+    // O(1); the supplied List is left empty
+    IntrusiveList(IntrusiveList&& l) noexcept;
+
+    // move assignment removes the objects of the calling List and takes
+    // the objects of the supplied List
+    IntrusiveList& operator=(IntrusiveList&& l) noexcept;
+
+    // destructor method removes every object from the list; the objects
+    // themselves are not destroyed
+    ~IntrusiveList();
+
+    // return the length of the list
+    intmax_t getLength(void) const { return length; };
+
+    // return true if the list holds no objects
+    bool isEmpty(void) const { return length == 0; };
+
+    // remove the first object from the List and return it; throws
+    // out_of_range if the List is empty
+    T& popFront(void);
+
+    // link the supplied object after the last object of the list; throws
+    // invalid_argument if the object is already in a list
+    void append(T& object);
+
+    // link the supplied object before the first object of the list; throws
+    // invalid_argument if the object is already in a list
+    void prepend(T& object);
+
+    // link the supplied object before the object the iterator refers to
+    // (or at the end, for the end iterator); returns an iterator to it
+    iterator insert(const_iterator pos, T& object);
+
+    // unlink the supplied object, which must be in this list, in O(1)
+    void erase(T& object);
+
+    // unlink the object the iterator refers to in O(1); returns an
+    // iterator to the object after it
+    iterator erase(const_iterator pos);
+
+    // return an iterator to the first object, or to just past the last one
+    iterator begin(void) { return iterator{root.next}; };
+    iterator end(void) { return iterator{&root}; };
+    const_iterator begin(void) const { return const_iterator{root.next}; };
+    const_iterator end(void) const { return const_iterator{const_cast<ListHook*>(&root)}; };
+    const_iterator cbegin(void) const { return begin(); };
+    const_iterator cend(void) const { return end(); };
+
+    // return an iterator to the supplied object, which must be in this list
+    iterator iteratorTo(T& object) { return iterator{static_cast<ListHook*>(&object)}; };
+
+    // move all of the objects of the supplied List to the end of the
+    // calling List in O(1), leaving the supplied List empty
+    void splice(IntrusiveList& rightList);
+
+    // move all of the objects of the supplied List to the end of the
+    // calling List, leaving the supplied List empty; see splice()
+    void concatenate(IntrusiveList&& rightList) { splice(rightList); };
+
+    // remove every object from the List; O(n), since the hook of every
+    // object is reset so the object can be put in another list
+    void clear(void);
+
+    // sort the objects using merge sort method; a bottom-up natural merge
+    // sort that only relinks the hooks, so no object is moved or copied and
+    // nothing is allocated; objects that compare equal keep their order;
+    // compares with `<` unless another comparison is supplied
+    // see: https://en.wikipedia.org/Merge_sort
+    template <typename Compare = std::less<T>>
+    void mergeSort(Compare compare = Compare{});
+
+private:
+
+    // link the supplied hook before `pos`
+    void linkBefore(ListHook* pos, ListHook* hook);
+
+    // unlink the supplied hook and reset its links
+    void unlink(ListHook* hook);
+
+    // take the objects of the supplied List, leaving it empty
+    void stealObjects(IntrusiveList& l);
+
+    // how ChainSort reaches the links to the next and previous hooks
+    struct HookLinks {
+        static ListHook*& next(ListHook* hook) { return hook->next; };
+        static ListHook*& prev(ListHook* hook) { return hook->prev; };
+    };
+
+    // return the object a hook belongs to
+    static T& objectOf(ListHook* hook) { return *static_cast<T*>(hook); };
+
+    // the list's own hook: `next` is the first object and `prev` the last;
+    // both point back at the root when the list is empty
+    ListHook root;
+
+    // the length of the list in number of objects
+    intmax_t length;
+};
+
+// the definitions of the template's member functions
+#include "IntrusiveList.tpp"
+
+#endif
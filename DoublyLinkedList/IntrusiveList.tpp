@@ -0,0 +1,244 @@
+#include <cstdint>
+#include <stdexcept>
+
+// CONSTRUCTOR
+template <typename T>
+IntrusiveList<T>::IntrusiveList()
+        : root{}, length{0} {
+
+    // an empty list is a circle of just the root
+    root.prev = &root;
+    root.next = &root;
+}
+
+// CONSTRUCTOR
+template <typename T>
+IntrusiveList<T>::IntrusiveList(IntrusiveList&& l) noexcept
+        : root{}, length{0} {
+
+    root.prev = &root;
+    root.next = &root;
+
+    stealObjects(l);
+}
+
+template <typename T>
+IntrusiveList<T>& IntrusiveList<T>::operator=(IntrusiveList&& l) noexcept {
+
+    // moving a list into itself leaves it as it is
+    if (this == &l) {
+        return *this;
+    }
+
+    // remove the objects of the calling List, then take the supplied List's
+    clear();
+    stealObjects(l);
+
+    return *this;
+}
+
+// DESTRUCTOR
+template <typename T>
+IntrusiveList<T>::~IntrusiveList() {
+
+    // the objects outlive the list, so they are left unlinked
+    clear();
+}
+
+template <typename T>
+T& IntrusiveList<T>::popFront(void) {
+
+    // if there's nothing to pop throw an out of range error
+    if (length == 0) {
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // unlink the first object and return it
+    ListHook* first = root.next;
+    unlink(first);
+
+    return objectOf(first);
+}
+
+template <typename T>
+void IntrusiveList<T>::append(T& object) {
+
+    // the last object is the one before the root
+    insert(end(), object);
+}
+
+template <typename T>
+void IntrusiveList<T>::prepend(T& object) {
+
+    // the first object is the one after the root
+    insert(begin(), object);
+}
+
+template <typename T>
+typename IntrusiveList<T>::iterator IntrusiveList<T>::insert(const_iterator pos, T& object) {
+
+    ListHook* hook = static_cast<ListHook*>(&object);
+
+    // the hook only has room for one set of links
+    if (hook->isLinked()) {
+        throw std::invalid_argument{"object is already in a list"};
+    }
+
+    // if the value of length will overflow upon being incremented
+    if (length == INTMAX_MAX) {
+        throw std::overflow_error{"IntrusiveList length exceeded max"};
+    }
+
+    linkBefore(pos.hook, hook);
+
+    return iterator{hook};
+}
+
+template <typename T>
+void IntrusiveList<T>::erase(T& object) {
+
+    unlink(static_cast<ListHook*>(&object));
+}
+
+template <typename T>
+typename IntrusiveList<T>::iterator IntrusiveList<T>::erase(const_iterator pos) {
+
+    // store the hook after the one being unlinked
+    ListHook* nextHook = pos.hook->next;
+
+    unlink(pos.hook);
+
+    return iterator{nextHook};
+}
+
+template <typename T>
+void IntrusiveList<T>::splice(IntrusiveList& rightList) {
+
+    // splicing a list onto itself, or splicing an empty list, changes nothing
+    if ((this == &rightList) || (rightList.length == 0)) {
+        return;
+    }
+
+    // the length can only grow up to the largest value it can hold
+    if (length > INTMAX_MAX - rightList.length) {
+        throw std::overflow_error{"IntrusiveList length exceeded max"};
+    }
+
+    // link the supplied List's chain between the last object and the root
+    ListHook* first = rightList.root.next;
+    ListHook* last = rightList.root.prev;
+
+    first->prev = root.prev;
+    root.prev->next = first;
+    last->next = &root;
+    root.prev = last;
+
+    length += rightList.length;
+
+    // leave the supplied List empty
+    rightList.root.prev = &rightList.root;
+    rightList.root.next = &rightList.root;
+    rightList.length = 0;
+}
+
+template <typename T>
+void IntrusiveList<T>::clear(void) {
+
+    // current hook; start at the first object of the list
+    ListHook* hook = root.next;
+
+    while (hook != &root) {
+
+        // store the hook of the next object
+        ListHook* nextHook = hook->next;
+
+        // mark the object as not being in a list
+        hook->prev = nullptr;
+        hook->next = nullptr;
+
+        // move to the next object
+        hook = nextHook;
+    }
+
+    // an empty list is a circle of just the root
+    root.prev = &root;
+    root.next = &root;
+    length = 0;
+}
+
+template <typename T>
+template <typename Compare>
+void IntrusiveList<T>::mergeSort(Compare compare) {
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // cut the circle open at the root, so the objects form a null-terminated
+    // chain, and sort it by rewriting the links between the hooks
+    root.prev->next = nullptr;
+
+    // two hooks are in order if their objects are
+    auto less = [&compare](ListHook* a, ListHook* b) {
+        return compare(objectOf(a), objectOf(b));
+    };
+    ListHook* last;
+    ListHook* first = ChainSort<ListHook, HookLinks>::sort(root.next, last, less);
+
+    // the sort links every hook but the first back to the one before it;
+    // link the first back to the root and close the circle
+    first->prev = &root;
+    root.next = first;
+    root.prev = last;
+    last->next = &root;
+}
+
+template <typename T>
+void IntrusiveList<T>::linkBefore(ListHook* pos, ListHook* hook) {
+
+    // the new hook sits between `pos` and the hook before it
+    hook->prev = pos->prev;
+    hook->next = pos;
+    pos->prev->next = hook;
+    pos->prev = hook;
+
+    length++;
+}
+
+template <typename T>
+void IntrusiveList<T>::unlink(ListHook* hook) {
+
+    // join the hooks on either side of the one being removed
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+
+    // mark the object as not being in a list
+    hook->prev = nullptr;
+    hook->next = nullptr;
+
+    length--;
+}
+
+template <typename T>
+void IntrusiveList<T>::stealObjects(IntrusiveList& l) {
+
+    // an empty list has nothing to take; the root of the calling List
+    // already points at itself
+    if (l.length == 0) {
+        return;
+    }
+
+    // the first and last objects point at the supplied List's root, so
+    // they are pointed at the calling List's root instead
+    root.next = l.root.next;
+    root.prev = l.root.prev;
+    root.next->prev = &root;
+    root.prev->next = &root;
+    length = l.length;
+
+    // leave the supplied List empty
+    l.root.prev = &l.root;
+    l.root.next = &l.root;
+    l.length = 0;
+}
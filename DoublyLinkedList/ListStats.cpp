@@ -0,0 +1,205 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+
+#include "ListStats.h"
+
+// the live counters of one operation; updated from any thread
+struct AtomicOperationStats {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> nanoseconds;
+    std::atomic<uint64_t> counters[LIST_COUNTER_COUNT];
+    std::atomic<uint64_t> latency[LIST_LATENCY_BUCKETS];
+};
+
+// the counters of every operation; zero-initialized before main() runs
+static AtomicOperationStats liveStats[LIST_OPERATION_COUNT];
+
+// the operation running on this thread, or Count if there is none
+static thread_local ListOperation currentOperation{ListOperation::Count};
+
+// counts added by the operation running on this thread; they are added to
+// the shared counters once, when the operation ends, so counting inside a
+// loop does not touch memory shared with other threads
+static thread_local uint64_t pendingCounters[LIST_COUNTER_COUNT]{};
+
+// return the bucket a call that took `ns` nanoseconds belongs in
+static std::size_t latencyBucket(uint64_t ns) {
+
+    // the number of bits needed to hold `ns`
+    std::size_t bucket = 0;
+    while ((ns > 0) && (bucket < LIST_LATENCY_BUCKETS - 1)) {
+        ns >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+ListStats listStats(void) {
+
+    ListStats stats{};
+
+    for (std::size_t op = 0; op < LIST_OPERATION_COUNT; op++) {
+
+        const AtomicOperationStats& live = liveStats[op];
+        ListOperationStats& copy = stats.operations[op];
+
+        copy.calls = live.calls.load(std::memory_order_relaxed);
+        copy.nanoseconds = live.nanoseconds.load(std::memory_order_relaxed);
+        for (std::size_t c = 0; c < LIST_COUNTER_COUNT; c++) {
+            copy.counters[c] = live.counters[c].load(std::memory_order_relaxed);
+        }
+        for (std::size_t b = 0; b < LIST_LATENCY_BUCKETS; b++) {
+            copy.latency[b] = live.latency[b].load(std::memory_order_relaxed);
+        }
+    }
+
+    return stats;
+}
+
+void resetListStats(void) {
+
+    for (AtomicOperationStats& live : liveStats) {
+
+        live.calls.store(0, std::memory_order_relaxed);
+        live.nanoseconds.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t>& counter : live.counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        for (std::atomic<uint64_t>& bucket : live.latency) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+const char* listOperationName(ListOperation op) {
+
+    static const char* const NAMES[LIST_OPERATION_COUNT]{
+        "construct", "destroy", "popFront", "at", "insertAt", "eraseAt", "append",
+        "prepend", "appendRange", "prependRange", "assign", "insert", "erase",
+        "concatenate", "splice", "split", "clear", "compact", "bubbleSort",
+        "mergeSort", "parallelMergeSort", "radixSort", "copyMergeSort",
+        "print", "save", "load"
+    };
+
+    return NAMES[static_cast<std::size_t>(op)];
+}
+
+const char* listCounterName(ListCounter counter) {
+
+    static const char* const NAMES[LIST_COUNTER_COUNT]{
+        "allocated", "freed", "walked", "compares", "swaps"
+    };
+
+    return NAMES[static_cast<std::size_t>(counter)];
+}
+
+// return the upper bound, in nanoseconds, of the bucket that holds the
+// call at the supplied fraction of all calls, sorted by time
+static uint64_t latencyPercentile(const ListOperationStats& stats, double fraction) {
+
+    uint64_t wanted = static_cast<uint64_t>(stats.calls * fraction);
+    uint64_t seen = 0;
+
+    for (std::size_t b = 0; b < LIST_LATENCY_BUCKETS; b++) {
+        seen += stats.latency[b];
+        if (seen > wanted) {
+            return uint64_t{1} << b;
+        }
+    }
+
+    return uint64_t{1} << (LIST_LATENCY_BUCKETS - 1);
+}
+
+void printListStats(std::ostream& outStream, const ListStats& stats) {
+
+    outStream << std::left << std::setw(19) << "operation" << std::right
+              << std::setw(12) << "calls" << std::setw(12) << "mean ns"
+              << std::setw(12) << "p50 ns <" << std::setw(12) << "p99 ns <";
+    for (std::size_t c = 0; c < LIST_COUNTER_COUNT; c++) {
+        outStream << std::setw(14) << listCounterName(static_cast<ListCounter>(c));
+    }
+    outStream << '\n';
+
+    for (std::size_t op = 0; op < LIST_OPERATION_COUNT; op++) {
+
+        const ListOperationStats& s = stats.operations[op];
+
+        // operations that were never called are left out
+        if (s.calls == 0) {
+            continue;
+        }
+
+        outStream << std::left << std::setw(19) << listOperationName(static_cast<ListOperation>(op))
+                  << std::right << std::setw(12) << s.calls << std::setw(12)
+                  << (s.nanoseconds / s.calls) << std::setw(12)
+                  << latencyPercentile(s, 0.5) << std::setw(12) << latencyPercentile(s, 0.99);
+        for (std::size_t c = 0; c < LIST_COUNTER_COUNT; c++) {
+            outStream << std::setw(14) << s.counters[c];
+        }
+        outStream << '\n';
+    }
+
+    outStream << std::flush;
+}
+
+void listStatsAdd(ListCounter counter, uint64_t n) {
+
+    // work done outside of any counted operation is not recorded
+    if (currentOperation == ListOperation::Count) {
+        return;
+    }
+
+    pendingCounters[static_cast<std::size_t>(counter)] += n;
+}
+
+// CONSTRUCTOR
+ListOperationScope::ListOperationScope(ListOperation op, bool counted)
+        : outermost{currentOperation == ListOperation::Count}, counted{counted},
+          op{op}, start{} {
+
+    // an operation called by another operation is part of the outer one
+    if (!outermost) {
+        return;
+    }
+
+    currentOperation = op;
+
+    if (counted) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+// DESTRUCTOR
+ListOperationScope::~ListOperationScope() {
+
+    if (!outermost) {
+        return;
+    }
+
+    currentOperation = ListOperation::Count;
+
+    AtomicOperationStats& live = liveStats[static_cast<std::size_t>(op)];
+
+    // move the counts of the operation to the shared counters
+    for (std::size_t c = 0; c < LIST_COUNTER_COUNT; c++) {
+        if (pendingCounters[c] != 0) {
+            live.counters[c].fetch_add(pendingCounters[c], std::memory_order_relaxed);
+            pendingCounters[c] = 0;
+        }
+    }
+
+    if (!counted) {
+        return;
+    }
+
+    // record the call and how long it took
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    live.calls.fetch_add(1, std::memory_order_relaxed);
+    live.nanoseconds.fetch_add(ns, std::memory_order_relaxed);
+    live.latency[latencyBucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
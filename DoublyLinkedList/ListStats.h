@@ -0,0 +1,122 @@
+#ifndef LISTSTATS_H
+#define LISTSTATS_H
+
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+
+// List Stats count what the operations of DoublyLinkedList do: how many
+// times each operation was called and how long the calls took, and how
+// many nodes each one allocated, freed and walked past, and how many
+// values it compared and swapped;
+// counting is only compiled in when DLL_INSTRUMENT is defined (build with
+// `make INSTRUMENT=1`); otherwise the counting macros expand to nothing
+// and listStats() returns all zeros;
+// the counters are shared by every list in the program, and work done
+// inside an operation that was called by another operation (such as the
+// appends done by concatenate) is counted towards the outer operation
+
+// the operations that are counted
+enum class ListOperation {
+    Construct, Destroy, PopFront, At, InsertAt, EraseAt, Append, Prepend,
+    AppendRange, PrependRange, Assign, Insert, Erase, Concatenate, Splice,
+    Split, Clear, Compact, BubbleSort, MergeSort, ParallelMergeSort,
+    RadixSort, CopyMergeSort, Print, Save, Load, Count
+};
+
+// the counters kept for every operation
+enum class ListCounter {
+    NodesAllocated, NodesFreed, NodesWalked, Comparisons, Swaps, Count
+};
+
+// number of operations and counters
+const std::size_t LIST_OPERATION_COUNT{static_cast<std::size_t>(ListOperation::Count)};
+const std::size_t LIST_COUNTER_COUNT{static_cast<std::size_t>(ListCounter::Count)};
+
+// calls are sorted into buckets by how long they took; bucket `i` holds
+// calls that took less than 2^i nanoseconds (and at least 2^(i-1))
+const std::size_t LIST_LATENCY_BUCKETS{48};
+
+// a snapshot of the counters of one operation
+struct ListOperationStats {
+    uint64_t calls;
+    uint64_t nanoseconds;
+    uint64_t counters[LIST_COUNTER_COUNT];
+    uint64_t latency[LIST_LATENCY_BUCKETS];
+};
+
+// a snapshot of the counters of every operation
+struct ListStats {
+    ListOperationStats operations[LIST_OPERATION_COUNT];
+};
+
+// return a copy of every counter; the counters keep running
+ListStats listStats(void);
+
+// set every counter back to zero
+void resetListStats(void);
+
+// return the name of an operation or counter
+const char* listOperationName(ListOperation op);
+const char* listCounterName(ListCounter counter);
+
+// print a table with a row for every operation that was called: the
+// number of calls, mean and approximate median and 99th percentile time
+// per call, and the counters
+void printListStats(std::ostream& outStream, const ListStats& stats);
+
+// add `n` to a counter of the operation running on this thread
+void listStatsAdd(ListCounter counter, uint64_t n);
+
+// counts one call of an operation and times it from construction to
+// destruction; does nothing if another operation is already running on
+// the same thread
+class ListOperationScope {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    ListOperationScope(const ListOperationScope&) = delete;
+    ListOperationScope& operator=(const ListOperationScope&) = delete;
+
+public:
+
+    // constructor method starts the operation; if `counted` is false the
+    // call is not counted or timed, but the work done on this thread is
+    // still counted towards `op` (used by the worker threads of
+    // parallelMergeSort)
+    explicit ListOperationScope(ListOperation op, bool counted = true);
+
+    // destructor method ends the operation and records its time
+    ~ListOperationScope();
+
+private:
+
+    // true if this scope started the operation running on this thread
+    bool outermost;
+    bool counted;
+    ListOperation op;
+    std::chrono::steady_clock::time_point start;
+};
+
+#ifdef DLL_INSTRUMENT
+
+// count a call of the named operation until the end of the enclosing block
+#define DLL_OPERATION(op) ListOperationScope dllOperationScope{ListOperation::op}
+
+// count the work done on this thread towards the named operation without
+// counting a call
+#define DLL_WORKER(op) ListOperationScope dllOperationScope{ListOperation::op, false}
+
+// add `n` to the named counter of the operation running on this thread
+#define DLL_COUNT(counter, n) listStatsAdd(ListCounter::counter, (n))
+
+#else
+
+#define DLL_OPERATION(op) ((void)0)
+#define DLL_WORKER(op) ((void)0)
+#define DLL_COUNT(counter, n) ((void)0)
+
+#endif
+
+#endif
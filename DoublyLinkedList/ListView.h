@@ -0,0 +1,98 @@
+#ifndef LISTVIEW_H
+#define LISTVIEW_H
+
+#include <cstdint>
+#include <memory>
+
+#include "DoublyLinkedList.h"
+
+// a List View refers to a range of values of a DoublyLinkedList without
+// copying them; reading through the view (at() and the iterators, which
+// are all const) reads the list's own nodes, and the first write through
+// the view (set()) copies the range into a list owned by the view, so the
+// viewed list is never changed; views are made by DoublyLinkedList::view()
+template <typename T, typename Allocator = PoolAllocator<T>>
+class ListView {
+
+    // the list creates views of itself
+    friend class DoublyLinkedList<T, Allocator>;
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    ListView(const ListView&) = delete;
+    ListView& operator=(const ListView&) = delete;
+
+public:
+
+    using List = DoublyLinkedList<T, Allocator>;
+    using const_iterator = typename List::const_iterator;
+
+    // views can be moved; a view that has copied its values takes the copy
+    ListView(ListView&& v) noexcept = default;
+    ListView& operator=(ListView&& v) noexcept = default;
+
+    // return the number of values in the view
+    intmax_t getLength(void) const { return length; };
+
+    // return true if the view has copied its values into its own list
+    bool isCopy(void) const { return copy != nullptr; };
+
+    // return a reference to the value at the specified index of the view;
+    // walks from the first node of the view or from where the last lookup
+    // ended, whichever is closer
+    const T& at(intmax_t idx) const;
+
+    // replace the value at the specified index of the view; the first call
+    // copies the values of the view, and only the copy is changed
+    void set(intmax_t idx, T value);
+
+    // iterators over the values of the view
+    const_iterator begin(void) const { return const_iterator{first, list}; };
+    const_iterator end(void) const { return const_iterator{afterLast(), list}; };
+    const_iterator cbegin(void) const { return begin(); };
+    const_iterator cend(void) const { return end(); };
+
+    // return a new list holding a copy of the values of the view
+    List toList(void) const;
+
+private:
+
+    // constructor method for a view of `len` nodes of the supplied list
+    // beginning at `first`
+    ListView(const List* list, Node<T>* first, intmax_t len);
+
+    // return the node after the last node of the view (null if the view
+    // ends at the tail of its list); found by the first call and then kept
+    Node<T>* afterLast(void) const;
+
+    // copy the values of the view into a list owned by the view and make
+    // the view refer to it, if that has not been done already
+    void makeCopy(void);
+
+    // the list whose nodes the view refers to; the view's own copy once
+    // it has one
+    const List* list;
+
+    // the first node of the view and the number of nodes in it
+    Node<T>* first;
+    intmax_t length;
+
+    // the node reached by the most recent lookup and its index within the
+    // view; lookups do not change the values, so they may move the cursor
+    // of a const view
+    mutable Node<T>* cursorNode;
+    mutable intmax_t cursorIdx;
+
+    // the node after the last node of the view, once afterLast() has
+    // found it
+    mutable Node<T>* endNode;
+    mutable bool endKnown;
+
+    // the list the values were copied into by the first write
+    std::unique_ptr<List> copy;
+};
+
+// the definitions of the template's member functions
+#include "ListView.tpp"
+
+#endif
@@ -0,0 +1,118 @@
+#include <cstdlib>
+#include <cstdint>
+#include <stdexcept>
+#include <memory>
+#include <utility>
+
+// CONSTRUCTOR
+template <typename T, typename Allocator>
+ListView<T, Allocator>::ListView(const List* list, Node<T>* first, intmax_t len)
+        : list{list}, first{first}, length{len},
+          cursorNode{first}, cursorIdx{0}, endNode{nullptr}, endKnown{false},
+          copy{nullptr} {
+
+    /* constructor has an empty body */
+
+}
+
+template <typename T, typename Allocator>
+const T& ListView<T, Allocator>::at(intmax_t idx) const {
+
+    // if the specified index is not part of the view
+    if ((idx < 0) || (idx >= length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"view index out of range"};
+    }
+
+    // start at the first node of the view or at the cursor, whichever is
+    // fewer nodes away from the index
+    Node<T>* currNode = first;
+    intmax_t currIdx = 0;
+
+    if (std::abs(cursorIdx - idx) < idx) {
+        currNode = cursorNode;
+        currIdx = cursorIdx;
+    }
+
+    // walk forward or backward until the desired node is reached
+    while (currIdx < idx) {
+        currNode = currNode->next;
+        currIdx++;
+    }
+    while (currIdx > idx) {
+        currNode = currNode->prev;
+        currIdx--;
+    }
+
+    // remember where the walk ended so the next walk can start there
+    cursorNode = currNode;
+    cursorIdx = currIdx;
+
+    return currNode->value;
+}
+
+template <typename T, typename Allocator>
+void ListView<T, Allocator>::set(intmax_t idx, T value) {
+
+    // the value is about to be written to, so the view needs its own copy
+    makeCopy();
+
+    // the copy belongs to the view, so its node can be changed
+    const_cast<T&>(at(idx)) = std::move(value);
+}
+
+template <typename T, typename Allocator>
+typename ListView<T, Allocator>::List ListView<T, Allocator>::toList(void) const {
+
+    // the new list gets an allocator of its own, as a copied list would
+    List newList{std::allocator_traits<Allocator>::select_on_container_copy_construction(
+        list->get_allocator())};
+
+    for (const T& value : *this) {
+        newList.append(value);
+    }
+
+    return newList;
+}
+
+template <typename T, typename Allocator>
+Node<T>* ListView<T, Allocator>::afterLast(void) const {
+
+    // the view's own copy holds exactly the values of the view
+    if ((copy != nullptr) || (length == 0)) {
+        return nullptr;
+    }
+
+    // the end only has to be found once; walk from the cursor, which is
+    // never further from the end than the first node is
+    if (!endKnown) {
+
+        Node<T>* currNode = cursorNode;
+        for (intmax_t i = cursorIdx; i < length; i++) {
+            currNode = currNode->next;
+        }
+
+        endNode = currNode;
+        endKnown = true;
+    }
+
+    return endNode;
+}
+
+template <typename T, typename Allocator>
+void ListView<T, Allocator>::makeCopy(void) {
+
+    // the values only need to be copied once
+    if (copy != nullptr) {
+        return;
+    }
+
+    copy = std::make_unique<List>(toList());
+
+    // refer to the copy from now on
+    list = copy.get();
+    first = copy->head;
+    cursorNode = first;
+    cursorIdx = 0;
+}
@@ -0,0 +1,308 @@
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "NodePool.h"
+
+// number of blocks in the first slab and the largest slab the pool requests
+static const std::size_t FIRST_SLAB_CAPACITY{64};
+static const std::size_t MAX_SLAB_CAPACITY{65'536};
+
+// round `n` up to the next multiple of `align`
+static std::size_t roundUp(std::size_t n, std::size_t align) {
+    return ((n + align - 1) / align) * align;
+}
+
+// CONSTRUCTOR
+NodePool::NodePool()
+        : blockSize{0}, blockAlign{0}, headerSize{0},
+          nextCapacity{FIRST_SLAB_CAPACITY}, firstSlab{nullptr},
+          lastSlab{nullptr}, currentSlab{nullptr}, currentIdx{0},
+          freeList{nullptr}, slabCount{0}, heapAllocations{0}, heapFrees{0} {
+
+    /* the block size is set by the first call to bind() */
+
+}
+
+// CONSTRUCTOR
+NodePool::NodePool(std::size_t blockSize, std::size_t blockAlign)
+        : blockSize{0}, blockAlign{0}, headerSize{0},
+          nextCapacity{FIRST_SLAB_CAPACITY}, firstSlab{nullptr},
+          lastSlab{nullptr}, currentSlab{nullptr}, currentIdx{0},
+          freeList{nullptr}, slabCount{0}, heapAllocations{0}, heapFrees{0} {
+
+    setBlockSize(blockSize, blockAlign);
+}
+
+// DESTRUCTOR
+NodePool::~NodePool() {
+
+    // return all of the memory owned by the pool to the heap
+    release();
+}
+
+void* NodePool::allocate(void) {
+
+    // reuse a block that has been returned to the pool if there is one
+    if (freeList != nullptr) {
+        FreeBlock* block = freeList;
+        freeList = freeList->next;
+        return block;
+    }
+
+    // if the current slab has been used up, move on to the next slab in
+    // the chain, or request a new slab if the chain has been used up
+    if ((currentSlab == nullptr) || (currentIdx == currentSlab->capacity)) {
+
+        if ((currentSlab != nullptr) && (currentSlab->next != nullptr)) {
+            currentSlab = currentSlab->next;
+        } else {
+            addSlab();
+            currentSlab = lastSlab;
+        }
+
+        currentIdx = 0;
+    }
+
+    // hand out the next block of the current slab
+    return blockAt(currentSlab, currentIdx++);
+}
+
+void* NodePool::allocateRun(std::size_t n, std::size_t& count) {
+
+    // if the current slab has been used up, move on to the next slab in
+    // the chain, or request a new slab that can hold every block asked for
+    if ((currentSlab == nullptr) || (currentIdx == currentSlab->capacity)) {
+
+        if ((currentSlab != nullptr) && (currentSlab->next != nullptr)) {
+            currentSlab = currentSlab->next;
+        } else {
+            addSlab(n);
+            currentSlab = lastSlab;
+        }
+
+        currentIdx = 0;
+    }
+
+    // hand out as many of the unused blocks of the current slab as asked for
+    count = currentSlab->capacity - currentIdx;
+    if (count > n) {
+        count = n;
+    }
+
+    void* first = blockAt(currentSlab, currentIdx);
+    currentIdx += count;
+
+    return first;
+}
+
+void* NodePool::allocateContiguous(std::size_t n) {
+
+    // the blocks get a slab of their own, which is put at the front of the
+    // chain; the slabs before the current slab are the ones whose blocks
+    // have been handed out, and every block of this one is handed out now
+    Slab* slab = newSlab(n);
+    slab->next = firstSlab;
+    firstSlab = slab;
+    if (lastSlab == nullptr) {
+        lastSlab = slab;
+    }
+
+    return blockAt(slab, 0);
+}
+
+void NodePool::deallocate(void* block) {
+
+    // push the block onto the front of the free list
+    FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = freeList;
+    freeList = freeBlock;
+}
+
+void NodePool::reset(void) {
+
+    // start carving blocks from the beginning of the first slab again;
+    // every block that was on the free list is part of a slab, so the free
+    // list can simply be forgotten
+    currentSlab = firstSlab;
+    currentIdx = 0;
+    freeList = nullptr;
+}
+
+void NodePool::release(void) {
+
+    // current slab; start at the first slab in the chain
+    Slab* slab = firstSlab;
+
+    while (slab != nullptr) {
+
+        // store the address of the next slab
+        Slab* nextSlab = slab->next;
+
+        // return the slab to the heap
+        ::operator delete(slab, std::align_val_t{blockAlign});
+        heapFrees++;
+
+        // move to the next slab
+        slab = nextSlab;
+    }
+
+    // reset the pool to the empty state
+    firstSlab = nullptr;
+    lastSlab = nullptr;
+    currentSlab = nullptr;
+    currentIdx = 0;
+    freeList = nullptr;
+    slabCount = 0;
+    nextCapacity = FIRST_SLAB_CAPACITY;
+}
+
+void NodePool::releaseOtherSlabs(const void* block) {
+
+    const unsigned char* address = static_cast<const unsigned char*>(block);
+
+    // the slab that is kept; found while the others are returned
+    Slab* kept = nullptr;
+
+    // current slab; start at the first slab in the chain
+    Slab* slab = firstSlab;
+
+    while (slab != nullptr) {
+
+        // store the address of the next slab
+        Slab* nextSlab = slab->next;
+
+        // keep the slab if the block lies inside it; otherwise, return the
+        // slab to the heap
+        const unsigned char* begin = static_cast<const unsigned char*>(blockAt(slab, 0));
+        const unsigned char* end = static_cast<const unsigned char*>(blockAt(slab, slab->capacity));
+
+        if ((address >= begin) && (address < end)) {
+            kept = slab;
+        } else {
+            ::operator delete(slab, std::align_val_t{blockAlign});
+            heapFrees++;
+            slabCount--;
+        }
+
+        // move to the next slab
+        slab = nextSlab;
+    }
+
+    // the kept slab is now the whole chain; blocks that it has never
+    // handed out can still be handed out if it was the current slab
+    firstSlab = kept;
+    lastSlab = kept;
+    if (currentSlab != kept) {
+        currentSlab = kept;
+        currentIdx = (kept == nullptr) ? 0 : kept->capacity;
+    }
+    if (kept != nullptr) {
+        kept->next = nullptr;
+    }
+
+    // every free block was in a slab that was returned, or is in use again
+    freeList = nullptr;
+}
+
+bool NodePool::adopt(NodePool& other) {
+
+    // a pool with no slabs has nothing to give
+    if (other.firstSlab == nullptr) {
+        return true;
+    }
+
+    // blocks of a different size cannot be handed out by this pool
+    if ((other.blockSize != blockSize) || (other.blockAlign != blockAlign)) {
+        return false;
+    }
+
+    // the slabs before the current slab are the ones whose blocks have
+    // been handed out, so the other pool's slabs go at the front of the
+    // chain; the slabs after the current slab are never in use
+    other.lastSlab->next = firstSlab;
+    firstSlab = other.firstSlab;
+    if (lastSlab == nullptr) {
+        lastSlab = other.lastSlab;
+    }
+    slabCount += other.slabCount;
+
+    // keep the other pool's free blocks if this pool has none of its own
+    if (freeList == nullptr) {
+        freeList = other.freeList;
+    }
+
+    // leave the other pool empty, as if its memory had been released
+    other.firstSlab = nullptr;
+    other.lastSlab = nullptr;
+    other.currentSlab = nullptr;
+    other.currentIdx = 0;
+    other.freeList = nullptr;
+    other.slabCount = 0;
+    other.nextCapacity = FIRST_SLAB_CAPACITY;
+
+    return true;
+}
+
+bool NodePool::bind(std::size_t size, std::size_t align) {
+
+    // the first object the pool is asked to hold decides its block size
+    if (blockSize == 0) {
+        setBlockSize(size, align);
+    }
+
+    return (size <= blockSize) && (align <= blockAlign);
+}
+
+void NodePool::setBlockSize(std::size_t size, std::size_t align) {
+
+    // a free block must be able to hold the free list pointer
+    blockAlign = (align < alignof(FreeBlock)) ? alignof(FreeBlock) : align;
+
+    // every block in a slab must start on an aligned address
+    blockSize = roundUp((size < sizeof(FreeBlock)) ? sizeof(FreeBlock) : size,
+                        blockAlign);
+
+    // the first block of a slab must also start on an aligned address
+    headerSize = roundUp(sizeof(Slab), blockAlign);
+}
+
+void* NodePool::blockAt(Slab* slab, std::size_t idx) const {
+
+    // blocks are laid out one after another following the slab header
+    return reinterpret_cast<unsigned char*>(slab) + headerSize + (idx * blockSize);
+}
+
+NodePool::Slab* NodePool::newSlab(std::size_t capacity) {
+
+    // request memory for the header and all of the blocks at once
+    void* memory = ::operator new(headerSize + (capacity * blockSize),
+                                  std::align_val_t{blockAlign});
+    heapAllocations++;
+    slabCount++;
+
+    // fill in the header of the new slab
+    Slab* slab = static_cast<Slab*>(memory);
+    slab->next = nullptr;
+    slab->capacity = capacity;
+
+    return slab;
+}
+
+void NodePool::addSlab(std::size_t minCapacity) {
+
+    Slab* slab = newSlab((minCapacity > nextCapacity) ? minCapacity : nextCapacity);
+
+    // add the slab to the end of the chain
+    if (lastSlab == nullptr) {
+        firstSlab = slab;
+    } else {
+        lastSlab->next = slab;
+    }
+    lastSlab = slab;
+
+    // each slab is twice the size of the previous one, up to a limit
+    if (nextCapacity < MAX_SLAB_CAPACITY) {
+        nextCapacity *= 2;
+    }
+}
@@ -0,0 +1,232 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// a Node Pool is a slab (arena) allocator for fixed-size blocks of memory;
+// blocks are carved out of large slabs obtained from the heap, so many
+// nodes can be allocated and freed without a heap call for each one;
+// freed blocks are kept on a free list and handed out again before any
+// new memory is requested from the heap
+class NodePool {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    NodePool(NodePool&&) = delete;
+    NodePool& operator=(NodePool&&) = delete;
+
+public:
+
+    // constructor method for an empty pool whose block size is decided by
+    // the first call to bind(); used by PoolAllocator, which does not know
+    // the size of the nodes until the container rebinds it
+    NodePool(void);
+
+    // constructor method for an empty pool;
+    // must be given the size and alignment (in bytes) of the blocks it
+    // will hand out; no memory is requested until the first allocation
+    NodePool(std::size_t blockSize, std::size_t blockAlign);
+
+    // destructor method frees every slab owned by the pool
+    ~NodePool();
+
+    // return the address of an unused block; a block from the free list is
+    // used if there is one, otherwise the next unused block of a slab
+    void* allocate(void);
+
+    // return the address of the first of `n` blocks that follow one
+    // another in memory; the blocks come from a new slab of exactly `n`
+    // blocks, and can be given back one at a time with deallocate()
+    void* allocateContiguous(std::size_t n);
+
+    // return the address of the first of up to `n` blocks that follow one
+    // another in memory, and store how many there are in `count`; the
+    // blocks are the unused part of the current slab (or of the next slab
+    // in the chain), or a new slab large enough for all `n` blocks if the
+    // chain is used up; the free list is not used; for filling a list with
+    // many nodes in a tight loop
+    void* allocateRun(std::size_t n, std::size_t& count);
+
+    // return a block to the pool so it can be handed out again
+    void deallocate(void* block);
+
+    // mark every block of every slab as unused without returning any
+    // memory to the heap; O(1) regardless of how many blocks are in use
+    void reset(void);
+
+    // return every slab to the heap; O(number of slabs)
+    void release(void);
+
+    // return every slab except the one holding the supplied block to the
+    // heap and forget the free list; only for when no block outside that
+    // slab is in use; O(number of slabs)
+    void releaseOtherSlabs(const void* block);
+
+    // take ownership of every slab of the supplied pool, leaving it empty;
+    // blocks the other pool handed out stay valid and can be given back to
+    // this pool; O(1) unless both pools have free lists, in which case the
+    // other pool's free blocks are only reused after the next reset();
+    // returns false, and takes nothing, if the block sizes differ
+    bool adopt(NodePool& other);
+
+    // set the size and alignment of the blocks if they have not been set
+    // yet; returns true if blocks of the pool can hold an object of the
+    // supplied size and alignment
+    bool bind(std::size_t size, std::size_t align);
+
+    // return the number of times the pool has requested memory from the heap
+    uintmax_t getHeapAllocations(void) const { return heapAllocations; };
+
+    // return the number of times the pool has returned memory to the heap
+    uintmax_t getHeapFrees(void) const { return heapFrees; };
+
+    // return the number of slabs currently owned by the pool
+    std::size_t getSlabCount(void) const { return slabCount; };
+
+private:
+
+    // every slab begins with this header; the blocks follow it
+    struct Slab { Slab* next; std::size_t capacity; };
+
+    // a block on the free list stores the address of the next free block
+    struct FreeBlock { FreeBlock* next; };
+
+    // return the address of block number `idx` of the supplied slab
+    void* blockAt(Slab* slab, std::size_t idx) const;
+
+    // request a slab of `capacity` blocks from the heap
+    Slab* newSlab(std::size_t capacity);
+
+    // request a new slab from the heap and add it to the end of the chain;
+    // the slab holds at least `minCapacity` blocks
+    void addSlab(std::size_t minCapacity = 0);
+
+    // set the block size, block alignment and header size
+    void setBlockSize(std::size_t size, std::size_t align);
+
+    // size and alignment of each block handed out by the pool
+    std::size_t blockSize;
+    std::size_t blockAlign;
+
+    // size of the slab header rounded up so the first block is aligned
+    std::size_t headerSize;
+
+    // number of blocks in the next slab requested from the heap
+    std::size_t nextCapacity;
+
+    // first and last slabs in the chain of slabs owned by the pool
+    Slab* firstSlab;
+    Slab* lastSlab;
+
+    // slab that new blocks are currently being carved from, and the index
+    // of the next block in that slab that has never been handed out
+    Slab* currentSlab;
+    std::size_t currentIdx;
+
+    // first block in the list of blocks that have been returned to the pool
+    FreeBlock* freeList;
+
+    // number of slabs in the chain
+    std::size_t slabCount;
+
+    // counters for heap calls made by the pool
+    uintmax_t heapAllocations;
+    uintmax_t heapFrees;
+};
+
+// a Pool Allocator is a standard allocator that takes single objects from
+// a NodePool; copies of an allocator, including copies rebound to another
+// type, share one pool, so containers using equal allocators can pass
+// nodes to each other; requests for more than one object, or for objects
+// that do not fit the pool's blocks, are sent to the heap
+template <typename T>
+class PoolAllocator {
+
+    // allocators of every type share their pool with each other
+    template <typename U> friend class PoolAllocator;
+
+public:
+
+    using value_type = T;
+
+    // a container moved into another takes the pool with its nodes
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    // constructor method for an allocator with a new, empty pool
+    PoolAllocator(void) : pool{std::make_shared<NodePool>()} {};
+
+    // copies share the pool; there is no move constructor, so an allocator
+    // that has been "moved from" still has a pool to allocate from
+    PoolAllocator(const PoolAllocator&) = default;
+    PoolAllocator& operator=(const PoolAllocator&) = default;
+
+    // constructor method for an allocator that shares the pool of an
+    // allocator of another type
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : pool{other.pool} {}
+
+    // return memory for `n` objects of type T
+    T* allocate(std::size_t n) {
+
+        // a single object that fits the pool's blocks comes from the pool
+        if ((n == 1) && pool->bind(sizeof(T), alignof(T))) {
+            return static_cast<T*>(pool->allocate());
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    };
+
+    // give back memory returned by allocate()
+    void deallocate(T* p, std::size_t n) {
+
+        // the pool's block size never changes once it is set, so this makes
+        // the same choice allocate() did
+        if ((n == 1) && pool->bind(sizeof(T), alignof(T))) {
+            pool->deallocate(p);
+        } else {
+            ::operator delete(p, std::align_val_t{alignof(T)});
+        }
+    };
+
+    // a copy of a container gets its own pool, so clearing either
+    // container can still free its nodes all at once
+    PoolAllocator select_on_container_copy_construction(void) const {
+        return PoolAllocator{};
+    };
+
+    // return the pool the allocator takes memory from
+    NodePool& getPool(void) const { return *pool; };
+
+    // return true if no other allocator shares this allocator's pool, i.e.
+    // every block handed out by the pool belongs to one container
+    bool ownsPoolAlone(void) const { return pool.use_count() == 1; };
+
+    // allocators are equal if they share a pool
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const { return pool == other.pool; }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const { return pool != other.pool; }
+
+private:
+
+    // the pool shared by this allocator and all of its copies
+    std::shared_ptr<NodePool> pool;
+};
+
+// true if the supplied allocator type is a PoolAllocator
+template <typename A>
+struct IsPoolAllocator : std::false_type {};
+
+template <typename T>
+struct IsPoolAllocator<PoolAllocator<T>> : std::true_type {};
+
+#endif
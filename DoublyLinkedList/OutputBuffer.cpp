@@ -0,0 +1,56 @@
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <unistd.h>
+
+#include "OutputBuffer.h"
+
+void OutputBuffer::put(const char* text, std::size_t n) {
+
+    // text that does not fit is written out in buffer-sized pieces
+    while (n > 0) {
+
+        if (used == CAPACITY) {
+            flush();
+        }
+
+        std::size_t chunk = (n < CAPACITY - used) ? n : CAPACITY - used;
+        std::memcpy(data + used, text, chunk);
+        used += chunk;
+        text += chunk;
+        n -= chunk;
+    }
+}
+
+void OutputBuffer::flush(void) {
+
+    if (stream != nullptr) {
+
+        // one call for the whole buffer
+        stream->write(data, used);
+
+    } else {
+
+        // write(2) may write fewer bytes than asked for, or be interrupted
+        // by a signal, so keep writing until the whole buffer is out
+        std::size_t written = 0;
+        while (written < used) {
+
+            ssize_t n = write(fd, data + written, used - written);
+
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error{errno, std::generic_category(),
+                                        "could not write list"};
+            }
+
+            written += n;
+        }
+    }
+
+    // the buffer is empty again
+    used = 0;
+}
@@ -0,0 +1,82 @@
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+#include <iostream>
+#include <sstream>
+#include <cstddef>
+#include <charconv>
+#include <type_traits>
+
+// an Output Buffer collects text in a fixed array and sends it to an
+// output stream or a file descriptor in large blocks; numbers are
+// formatted with std::to_chars, so putting a number never allocates
+// memory or touches the stream
+class OutputBuffer {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+public:
+
+    // number of bytes collected before they are written out
+    static const std::size_t CAPACITY{1 << 16};
+
+    // constructor method for a buffer that writes to an output stream
+    explicit OutputBuffer(std::ostream& outStream)
+            : used{0}, stream{&outStream}, fd{-1} {};
+
+    // constructor method for a buffer that writes straight to a file
+    // descriptor with write(2)
+    explicit OutputBuffer(int fd) : used{0}, stream{nullptr}, fd{fd} {};
+
+    // add `n` bytes of text to the buffer
+    void put(const char* text, std::size_t n);
+
+    // add a value to the buffer; integers and floating point numbers are
+    // formatted in place (floating point numbers in their shortest exact
+    // form, ignoring the stream's precision), anything else goes through
+    // operator<<
+    template <typename T>
+    void put(const T& value) {
+
+        // bool and the character types are printed as text by operator<<,
+        // so they are not formatted as numbers
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                      !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+                      !std::is_same_v<T, unsigned char>) {
+
+            // the longest number always fits in 64 bytes
+            if (CAPACITY - used < 64) {
+                flush();
+            }
+
+            std::to_chars_result result = std::to_chars(data + used, data + CAPACITY, value);
+            used = result.ptr - data;
+
+        } else {
+
+            std::ostringstream text{};
+            text << value;
+            const std::string& s = text.str();
+            put(s.data(), s.size());
+        }
+    }
+
+    // write every byte in the buffer and empty it; throws system_error if
+    // the file descriptor cannot be written to
+    void flush(void);
+
+private:
+
+    // the text collected so far and the number of bytes of it
+    char data[CAPACITY];
+    std::size_t used;
+
+    // where the text is written; `stream` is null when writing to `fd`
+    std::ostream* stream;
+    int fd;
+};
+
+#endif
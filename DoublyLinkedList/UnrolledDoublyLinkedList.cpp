@@ -0,0 +1,399 @@
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <new>
+#include <vector>
+
+#include "UnrolledDoublyLinkedList.h"
+
+// CONSTRUCTOR
+UnrolledDoublyLinkedList::UnrolledDoublyLinkedList()
+        : head{nullptr}, tail{nullptr}, length{0},
+          nodePool{sizeof(UnrolledNode), alignof(UnrolledNode)} {
+
+    /* constructor has an empty body */
+
+}
+
+// CONSTRUCTOR
+UnrolledDoublyLinkedList::UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList& l,
+                                                   intmax_t startIdx, intmax_t len)
+        : head{nullptr}, tail{nullptr}, length{0},
+          nodePool{sizeof(UnrolledNode), alignof(UnrolledNode)} {
+
+    // current node; start at the head of the list provided
+    UnrolledNode* currNode = l.head;
+
+    // skip whole nodes until the node holding index `startIdx` is reached
+    while ((currNode != nullptr) && (startIdx >= currNode->count)) {
+        startIdx -= currNode->count;
+        currNode = currNode->next;
+    }
+
+    // copy `len` values (or until the end of the list is reached)
+    // beginning at index `startIdx` of the current node
+    while ((currNode != nullptr) && (len > 0)) {
+
+        for (int i = currNode->begin + startIdx;
+             (i < currNode->begin + currNode->count) && (len > 0); i++, len--) {
+            append(currNode->values[i]);
+        }
+
+        // every node after the first is copied from its first value
+        startIdx = 0;
+        currNode = currNode->next;
+    }
+}
+
+// DESTRUCTOR
+UnrolledDoublyLinkedList::~UnrolledDoublyLinkedList() {
+
+    // every node lives in a slab owned by the node pool, and the pool's
+    // destructor returns the slabs to the heap
+
+    // set head and tail pointers to null
+    head = nullptr;
+    tail = nullptr;
+}
+
+int UnrolledDoublyLinkedList::popFront(void) {
+
+    // if there's nothing to pop throw an out of range error
+    if (length == 0) {
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // take the first value of the head node
+    int v = head->values[head->begin];
+    head->begin++;
+    head->count--;
+
+    // if the head node is now empty, remove it from the list
+    if (head->count == 0) {
+
+        UnrolledNode* nodeToPop = head;
+        head = head->next;
+
+        if (head == nullptr) {
+            tail = nullptr;
+        } else {
+            head->prev = nullptr;
+        }
+
+        destroyNode(nodeToPop);
+    }
+
+    // decrement the length by one
+    decrementLength();
+
+    return v;
+}
+
+int& UnrolledDoublyLinkedList::at(int idx) {
+
+    // if the specified index does not exist
+    if ((idx < 0) || (idx >= length)) {
+
+        // throw an out of range error
+        throw std::out_of_range{"list index out of range"};
+    }
+
+    // start at the head node
+    UnrolledNode* currNode = head;
+
+    // skip whole nodes until the node holding the index is reached
+    while (idx >= currNode->count) {
+        idx -= currNode->count;
+        currNode = currNode->next;
+    }
+
+    // return a reference to the value within the current node
+    return currNode->values[currNode->begin + idx];
+}
+
+void UnrolledDoublyLinkedList::append(int i) {
+
+    if (length == 0) {
+
+        // create the first node of the list; values are added from the
+        // start of the array
+        tail = createNode(0);
+        head = tail;
+
+    // if there is no room after the last value of the tail node
+    } else if (tail->begin + tail->count == UNROLLED_NODE_CAPACITY) {
+
+        // if there is room before the first value, move the values to
+        // the start of the array; otherwise, add a new node after the tail
+        if (tail->begin > 0) {
+            std::memmove(tail->values, tail->values + tail->begin,
+                         tail->count * sizeof(int));
+            tail->begin = 0;
+        } else {
+            tail->next = createNode(0);
+            tail->next->prev = tail;
+            tail = tail->next;
+        }
+    }
+
+    // store the value after the last value of the tail node
+    tail->values[tail->begin + tail->count] = i;
+    tail->count++;
+
+    // increment length
+    incrementLength();
+}
+
+void UnrolledDoublyLinkedList::prepend(int i) {
+
+    if (length == 0) {
+
+        // create the first node of the list; values are added from the
+        // end of the array
+        head = createNode(UNROLLED_NODE_CAPACITY);
+        tail = head;
+
+    // if there is no room before the first value of the head node
+    } else if (head->begin == 0) {
+
+        // if there is room after the last value, move the values to the
+        // end of the array; otherwise, add a new node before the head
+        if (head->count < UNROLLED_NODE_CAPACITY) {
+            int newBegin = UNROLLED_NODE_CAPACITY - head->count;
+            std::memmove(head->values + newBegin, head->values,
+                         head->count * sizeof(int));
+            head->begin = newBegin;
+        } else {
+            head->prev = createNode(UNROLLED_NODE_CAPACITY);
+            head->prev->next = head;
+            head = head->prev;
+        }
+    }
+
+    // store the value before the first value of the head node
+    head->begin--;
+    head->values[head->begin] = i;
+    head->count++;
+
+    // increment length
+    incrementLength();
+}
+
+void UnrolledDoublyLinkedList::concatenate(const UnrolledDoublyLinkedList& rightList) {
+
+    // start at the head of the list supplied in the function call
+    UnrolledNode* currNode = rightList.head;
+
+    // iterate through each node in the supplied List
+    while (currNode != nullptr) {
+
+        // copy each of the values held by the node to the calling List
+        for (int i = currNode->begin; i < currNode->begin + currNode->count; i++) {
+            append(currNode->values[i]);
+        }
+
+        // move to the next mode in the supplied List
+        currNode = currNode->next;
+    }
+}
+
+void UnrolledDoublyLinkedList::clear(void) {
+
+    // every node lives in a slab owned by the node pool; resetting the pool
+    // frees all of the nodes at once and keeps the slabs for reuse
+    nodePool.reset();
+
+    // set head and tail pointers to null
+    head = nullptr;
+    tail = nullptr;
+
+    // reset length to 0
+    length = 0;
+}
+
+void UnrolledDoublyLinkedList::bubbleSort(void) {
+
+    // remains true if the list is sorted; otherwise, changed to false
+    bool sorted = false;
+
+    while (!sorted) {
+
+        // if no values are swapped after an iteration through the list, it is sorted
+        sorted = true;
+
+        // the value visited before the current one; null at the start
+        int* prevValue = nullptr;
+
+        // visit every value of every node in order
+        for (UnrolledNode* currNode = head; currNode != nullptr; currNode = currNode->next) {
+            for (int i = currNode->begin; i < currNode->begin + currNode->count; i++) {
+
+                int* currValue = &currNode->values[i];
+
+                // if the previous and current value are out of order
+                if ((prevValue != nullptr) && (*prevValue > *currValue)) {
+
+                    // swap the two values
+                    int temp = *prevValue;
+                    *prevValue = *currValue;
+                    *currValue = temp;
+
+                    // set sorted to false
+                    sorted = false;
+                }
+
+                prevValue = currValue;
+            }
+        }
+    }
+}
+
+void UnrolledDoublyLinkedList::mergeSort(void) {
+
+    // if there is nothing to sort, do nothing
+    if (length < 2) {
+        return;
+    }
+
+    // copy the values of the list into a contiguous buffer
+    std::vector<int> values(length);
+    std::vector<int> buffer(length);
+
+    intmax_t k = 0;
+    for (UnrolledNode* currNode = head; currNode != nullptr; currNode = currNode->next) {
+        for (int i = currNode->begin; i < currNode->begin + currNode->count; i++) {
+            values[k++] = currNode->values[i];
+        }
+    }
+
+    // merge neighbouring sorted ranges of `width` values from `values`
+    // into `buffer`, then swap the two; each pass doubles the width
+    for (intmax_t width = 1; width < length; width *= 2) {
+
+        for (intmax_t left = 0; left < length; left += 2 * width) {
+
+            // bounds of the two ranges being merged
+            intmax_t mid = (left + width < length) ? left + width : length;
+            intmax_t right = (left + 2 * width < length) ? left + 2 * width : length;
+
+            intmax_t a = left;
+            intmax_t b = mid;
+            intmax_t out = left;
+
+            // take from the left range on ties so the sort is stable
+            while ((a < mid) && (b < right)) {
+                buffer[out++] = (values[a] <= values[b]) ? values[a++] : values[b++];
+            }
+            while (a < mid) { buffer[out++] = values[a++]; }
+            while (b < right) { buffer[out++] = values[b++]; }
+        }
+
+        values.swap(buffer);
+    }
+
+    // write the sorted values back into the nodes in one pass
+    k = 0;
+    for (UnrolledNode* currNode = head; currNode != nullptr; currNode = currNode->next) {
+        for (int i = currNode->begin; i < currNode->begin + currNode->count; i++) {
+            currNode->values[i] = values[k++];
+        }
+    }
+}
+
+void UnrolledDoublyLinkedList::writeTo(int fd) {
+
+    // the values are formatted into a buffer, which is written to the file
+    // descriptor each time it fills up
+    OutputBuffer buffer{fd};
+    putValues(buffer);
+    buffer.flush();
+}
+
+UnrolledNode* UnrolledDoublyLinkedList::createNode(int begin) {
+
+    // begin the lifetime of a node in a block taken from the node pool
+    UnrolledNode* node = new (nodePool.allocate()) UnrolledNode;
+
+    // the new node is not linked to any others and holds no values
+    node->prev = nullptr;
+    node->next = nullptr;
+    node->begin = begin;
+    node->count = 0;
+
+    return node;
+}
+
+void UnrolledDoublyLinkedList::destroyNode(UnrolledNode* node) {
+
+    // hand the block that held the node back to the node pool
+    nodePool.deallocate(node);
+}
+
+void UnrolledDoublyLinkedList::putValues(OutputBuffer& buffer) {
+
+    // number of values put in the buffer so far
+    intmax_t printed = 0;
+
+    // visit every value of every node in order
+    for (UnrolledNode* currNode = head; currNode != nullptr; currNode = currNode->next) {
+        for (int i = currNode->begin; i < currNode->begin + currNode->count; i++) {
+
+            // every value but the first is preceded by a comma
+            if (printed > 0) {
+                buffer.put(", ", 2);
+
+                // print 25 values per line
+                if ((printed % 25) == 0) {
+                    buffer.put("\n", 1);
+                }
+            }
+
+            buffer.put(currNode->values[i]);
+            printed++;
+        }
+    }
+}
+
+void UnrolledDoublyLinkedList::incrementLength(void) {
+
+    // if the value of length will overflow upon being incremented
+    if (length == INTMAX_MAX) {
+
+        // throw an error
+        throw std::overflow_error{"UnrolledDoublyLinkedList length exceeded "
+                                  "max"};
+
+    } else {
+
+        // increment length
+        length++;
+    }
+}
+
+void UnrolledDoublyLinkedList::decrementLength(void) {
+
+    // if the list already has no elements
+    if (length == 0) {
+
+        // throw and error
+        throw std::underflow_error{"UnrolledDoublyLinkedList length cannot be "
+                                   "shortened below zero"};
+
+    } else {
+
+        // decrement length
+        length--;
+    }
+}
+
+std::ostream& operator<<(std::ostream& outStream, UnrolledDoublyLinkedList& linkedList) {
+
+    // the values are formatted into a buffer, which is sent to the stream
+    // in large blocks rather than one value at a time
+    OutputBuffer buffer{outStream};
+    linkedList.putValues(buffer);
+    buffer.flush();
+
+    return outStream;
+}
@@ -0,0 +1,131 @@
+#ifndef UNROLLEDDOUBLYLINKEDLIST_H
+#define UNROLLEDDOUBLYLINKEDLIST_H
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+
+#include "NodePool.h"
+#include "OutputBuffer.h"
+
+// number of values held by each node of an Unrolled List; chosen so that
+// a node (two pointers, two counters and the values) is 128 bytes, i.e.
+// exactly two 64-byte cache lines
+const int UNROLLED_NODE_CAPACITY{26};
+
+// the nodes of an Unrolled List each hold a small array of values; the
+// values in use are `values[begin]` through `values[begin + count - 1]`
+struct UnrolledNode {
+    UnrolledNode* prev;
+    UnrolledNode* next;
+    int begin;
+    int count;
+    int values[UNROLLED_NODE_CAPACITY];
+};
+
+// an Unrolled Doubly-Linked List stores the same sequence of values as a
+// DoublyLinkedList, but each node holds up to UNROLLED_NODE_CAPACITY
+// values instead of one; walking the list reads values that are next to
+// each other in memory, and the two pointers of a node are shared by all
+// of its values, so each value takes about 5 bytes instead of 24
+class UnrolledDoublyLinkedList {
+
+    // friend function to put the list to an output stream
+    friend std::ostream& operator<<(std::ostream&, UnrolledDoublyLinkedList&);
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList&) = delete;
+    UnrolledDoublyLinkedList& operator=(const UnrolledDoublyLinkedList&) = delete;
+    UnrolledDoublyLinkedList(UnrolledDoublyLinkedList&&) = delete;
+    UnrolledDoublyLinkedList& operator=(UnrolledDoublyLinkedList&&) = delete;
+
+public:
+
+    // constructor method for a empty list;
+    // initializes head and tail node pointers to null, and length to 0
+    UnrolledDoublyLinkedList(void);
+
+    // constructor method to make a copy of a list;
+    // must be given a List object, an index number at which to start,and
+    // a number of values to copy (i.e. length)
+    UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList& l, intmax_t startIdx,
+                             intmax_t len);
+
+    // destructor method frees the memory given to the nodes in the list
+    ~UnrolledDoublyLinkedList();
+
+    // return the length of the list
+    int getLength(void) const { return length; };
+
+    // remove the first element from the List are return its value
+    int popFront(void);
+
+    // return a reference to the value stored at the specified index
+    int& at(int idx);
+
+    // add the supplied value to the end of the list; increment length by one
+    void append(int i);
+
+    // add the supplied value to the beginning of the list; increment length by one
+    void prepend(int i);
+
+    // add all of the elements of the supplied List to the end of the calling List;
+    // this function creates a copy of each of the values of the supplied List
+    void concatenate(const UnrolledDoublyLinkedList&);
+
+    // delete all of the elements from the List and reset the length to 0
+    void clear(void);
+
+    // sort the values in the array using bubble sort method
+    // see: https://en.wikipedia.org/wiki/Bubble_sort
+    void bubbleSort(void);
+
+    // sort the values in the array using merge sort method; the values are
+    // merged through a temporary buffer and written back in one pass
+    // see: https://en.wikipedia.org/Merge_sort
+    void mergeSort(void);
+
+    // write the values of the list to a file descriptor in the same layout
+    // as operator<<, in large blocks with write(2); throws system_error if
+    // the write fails
+    void writeTo(int fd);
+
+    // return the pool the nodes of the list are allocated from
+    const NodePool& getNodePool(void) const { return nodePool; };
+
+private:
+
+    // take an empty node from the node pool; `begin` is where the first
+    // value will be stored
+    UnrolledNode* createNode(int begin);
+
+    // return a node to the node pool
+    void destroyNode(UnrolledNode* node);
+
+    // put every value in the supplied buffer, separated by commas with 25
+    // values per line
+    void putValues(OutputBuffer& buffer);
+
+    // increment length by 1
+    void incrementLength(void);
+
+    // decrement (decrease) length by 1
+    void decrementLength(void);
+
+    // a pointer to the first node in the list
+    UnrolledNode* head;
+
+    // a pointer to the last node in the list
+    UnrolledNode* tail;
+
+    // the length of the list in number of values
+    intmax_t length;
+
+    // slab allocator that every node of the list is taken from
+    NodePool nodePool;
+};
+
+std::ostream& operator<<(std::ostream& outStream, UnrolledDoublyLinkedList& linkedList);
+
+#endif
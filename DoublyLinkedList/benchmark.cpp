@@ -0,0 +1,539 @@
+/*
+Times the operations of DoublyLinkedList, UnrolledDoublyLinkedList,
+CompactDoublyLinkedList, std::list and std::vector on lists of 1K to 10M random values, and
+IntrusiveList against a DoublyLinkedList of pointers to the same objects, and prints
+the results as a table, CSV or JSON so they can be compared between runs.
+Usage: benchmark [--csv | --json] [--max-size N] [--out FILE]
+Built with `make bench INSTRUMENT=1`, it also reports the ListStats counters.
+*/
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "DoublyLinkedList.h"
+#include "UnrolledDoublyLinkedList.h"
+#include "CompactDoublyLinkedList.h"
+#include "IntrusiveList.h"
+
+// one timed operation on one container at one list size
+struct Result {
+    std::string container;
+    std::string operation;
+    intmax_t size;
+    intmax_t ops;
+    double seconds;
+};
+
+// a stream buffer that throws away everything written to it, so printing
+// a list measures formatting rather than memory or disk
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// longest list a quadratic operation is timed on
+const intmax_t QUADRATIC_MAX_SIZE{10'000};
+
+// longest std::vector that prepend and popFront (which move every value)
+// are timed on
+const intmax_t VECTOR_FRONT_MAX_SIZE{100'000};
+
+// number of random indices looked up by the random `at` benchmark, and
+// the longest linked list it is timed on (each lookup walks the list)
+const intmax_t RANDOM_ACCESSES{10'000};
+const intmax_t RANDOM_AT_MAX_SIZE{100'000};
+
+// number and length of the windows taken by the view benchmarks
+const intmax_t WINDOWS{1'000};
+const intmax_t WINDOW_LENGTH{100};
+
+// every operation is repeated until it has run for at least this long
+const double MIN_SECONDS{0.05};
+
+// ***************************************
+// How each operation is done on each kind of container
+
+// print the values of a standard container in the layout DoublyLinkedList
+// uses: comma separated, 25 values per line
+template <typename Range>
+static void printRange(std::ostream& out, const Range& r) {
+
+    intmax_t printed = 0;
+    for (int v : r) {
+        if (printed > 0) {
+            out << ", ";
+            if ((printed % 25) == 0) {
+                out << '\n';
+            }
+        }
+        out << v;
+        printed++;
+    }
+}
+
+// DoublyLinkedList, UnrolledDoublyLinkedList and CompactDoublyLinkedList
+// share one interface
+template <typename List>
+struct Ops {
+    static const bool HAS_BUBBLE_SORT{true};
+    // the unrolled list does not remember where the last lookup ended, so
+    // reading every index in order is quadratic for it
+    static const bool SEQUENTIAL_AT_IS_LINEAR{!std::is_same_v<List, UnrolledDoublyLinkedList>};
+    static const bool AT_IS_CONSTANT{false};
+    static void append(List& l, int v) { l.append(v); }
+    static void prepend(List& l, int v) { l.prepend(v); }
+    static int popFront(List& l) { return l.popFront(); }
+    static int& at(List& l, intmax_t i) { return l.at(static_cast<int>(i)); }
+    static void concatenate(List& l, const List& r) { l.concatenate(r); }
+    static void mergeSort(List& l) { l.mergeSort(); }
+    static void bubbleSort(List& l) { l.bubbleSort(); }
+    static void clear(List& l) { l.clear(); }
+    static void print(std::ostream& out, List& l) { out << l; }
+};
+
+template <>
+struct Ops<std::list<int>> {
+    using List = std::list<int>;
+    static const bool HAS_BUBBLE_SORT{false};
+    static const bool SEQUENTIAL_AT_IS_LINEAR{false};
+    static const bool AT_IS_CONSTANT{false};
+    static void append(List& l, int v) { l.push_back(v); }
+    static void prepend(List& l, int v) { l.push_front(v); }
+    static int popFront(List& l) { int v = l.front(); l.pop_front(); return v; }
+    static int& at(List& l, intmax_t i) { return *std::next(l.begin(), i); }
+    static void concatenate(List& l, const List& r) { l.insert(l.end(), r.begin(), r.end()); }
+    static void mergeSort(List& l) { l.sort(); }
+    static void bubbleSort(List&) {}
+    static void clear(List& l) { l.clear(); }
+    static void print(std::ostream& out, List& l) { printRange(out, l); }
+};
+
+template <>
+struct Ops<std::vector<int>> {
+    using List = std::vector<int>;
+    static const bool HAS_BUBBLE_SORT{false};
+    static const bool SEQUENTIAL_AT_IS_LINEAR{true};
+    static const bool AT_IS_CONSTANT{true};
+    static void append(List& l, int v) { l.push_back(v); }
+    static void prepend(List& l, int v) { l.insert(l.begin(), v); }
+    static int popFront(List& l) { int v = l.front(); l.erase(l.begin()); return v; }
+    static int& at(List& l, intmax_t i) { return l[i]; }
+    static void concatenate(List& l, const List& r) { l.insert(l.end(), r.begin(), r.end()); }
+    static void mergeSort(List& l) { std::stable_sort(l.begin(), l.end()); }
+    static void bubbleSort(List&) {}
+    static void clear(List& l) { l.clear(); }
+    static void print(std::ostream& out, List& l) { printRange(out, l); }
+};
+
+// ***************************************
+// Timing
+
+// fill the supplied list with `n` random values
+template <typename List>
+static void fillRandom(List& l, intmax_t n, unsigned seed) {
+
+    std::mt19937 rng{seed};
+
+    for (intmax_t i = 0; i < n; i++) {
+        Ops<List>::append(l, static_cast<int>(rng() % 1'000'000));
+    }
+}
+
+// return the average number of seconds one run of `op` takes; `setup`
+// runs before each run and is not timed
+template <typename Setup, typename Op>
+static double measure(Setup setup, Op op) {
+
+    double total = 0;
+    int runs = 0;
+
+    while ((total < MIN_SECONDS) && (runs < 1'000)) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double>(end - start).count();
+        runs++;
+    }
+
+    return total / runs;
+}
+
+// time every operation on a container of type List holding `n` values
+template <typename List>
+static void benchContainer(const std::string& name, intmax_t n,
+                           std::vector<Result>& results) {
+
+    // the list being timed, and a second list for concatenate
+    List l{};
+    List other{};
+    std::mt19937 rng{7};
+
+    // results of reads are added here so the compiler cannot skip them
+    volatile long long sink = 0;
+
+    auto record = [&](const char* operation, intmax_t ops, double seconds) {
+        results.push_back(Result{name, operation, n, ops, seconds});
+    };
+
+    // put `n` random values in the list being timed
+    auto refill = [&] { Ops<List>::clear(l); fillRandom(l, n, 1); };
+
+    record("append", n, measure([&] { Ops<List>::clear(l); }, [&] {
+        for (intmax_t i = 0; i < n; i++) { Ops<List>::append(l, static_cast<int>(i)); }
+    }));
+
+    // std::vector moves every value to add or remove one at the front
+    if (!std::is_same_v<List, std::vector<int>> || (n <= VECTOR_FRONT_MAX_SIZE)) {
+
+        record("prepend", n, measure([&] { Ops<List>::clear(l); }, [&] {
+            for (intmax_t i = 0; i < n; i++) { Ops<List>::prepend(l, static_cast<int>(i)); }
+        }));
+
+        record("popFront", n, measure(refill, [&] {
+            long long sum = 0;
+            for (intmax_t i = 0; i < n; i++) { sum += Ops<List>::popFront(l); }
+            sink = sink + sum;
+        }));
+    }
+
+    // the lookups do not change the list, so it is filled once for both
+    refill();
+
+    if (Ops<List>::SEQUENTIAL_AT_IS_LINEAR || (n <= QUADRATIC_MAX_SIZE)) {
+        record("at (sequential)", n, measure([] {}, [&] {
+            long long sum = 0;
+            for (intmax_t i = 0; i < n; i++) { sum += Ops<List>::at(l, i); }
+            sink = sink + sum;
+        }));
+    }
+
+    if (Ops<List>::AT_IS_CONSTANT || (n <= RANDOM_AT_MAX_SIZE)) {
+        std::vector<intmax_t> indices(RANDOM_ACCESSES);
+        for (intmax_t& idx : indices) { idx = rng() % n; }
+        record("at (random)", RANDOM_ACCESSES, measure([] {}, [&] {
+            long long sum = 0;
+            for (intmax_t idx : indices) { sum += Ops<List>::at(l, idx); }
+            sink = sink + sum;
+        }));
+    }
+
+    fillRandom(other, n, 2);
+    record("concatenate", n, measure(refill, [&] { Ops<List>::concatenate(l, other); }));
+
+    record("mergeSort", n, measure(refill, [&] { Ops<List>::mergeSort(l); }));
+
+    if (Ops<List>::HAS_BUBBLE_SORT && (n <= QUADRATIC_MAX_SIZE)) {
+        record("bubbleSort", n, measure(refill, [&] { Ops<List>::bubbleSort(l); }));
+    }
+
+    record("clear", n, measure(refill, [&] { Ops<List>::clear(l); }));
+
+    NullBuffer nullBuffer{};
+    std::ostream nullStream{&nullBuffer};
+    record("operator<<", n, measure(refill, [&] { Ops<List>::print(nullStream, l); }));
+
+    // the file descriptor path of the custom lists, writing to /dev/null
+    if constexpr (!std::is_same_v<List, std::list<int>> && !std::is_same_v<List, std::vector<int>>) {
+        int fd = open("/dev/null", O_WRONLY);
+        record("writeTo", n, measure(refill, [&] { l.writeTo(fd); }));
+        close(fd);
+    }
+
+    // operations that only DoublyLinkedList has
+    if constexpr (std::is_same_v<List, DoublyLinkedList<int>>) {
+        // filling the list from an array in one call, rather than one
+        // append per value as the "append" record does
+        std::vector<int> values(n);
+        for (intmax_t i = 0; i < n; i++) { values[i] = static_cast<int>(i); }
+        record("append (range)", n, measure([&] { l.clear(); }, [&] {
+            l.append(values.begin(), values.end());
+        }));
+        record("prepend_range", n, measure([&] { l.clear(); }, [&] {
+            l.prepend_range(values.begin(), values.end());
+        }));
+        record("assign", n, measure([&] { l.clear(); }, [&] { l.assign(n, 7); }));
+
+        record("copyMergeSort", n, measure(refill, [&] { l.copyMergeSort(); }));
+        record("parallelMergeSort", n, measure(refill, [&] { l.parallelMergeSort(); }));
+        record("radixSort", n, measure(refill, [&] { l.radixSort(); }));
+
+        // input that is already in order, in reverse order, or in order
+        // except for one value in a hundred
+        auto sorted = [&] { refill(); l.radixSort(); };
+        auto reversed = [&] {
+            refill();
+            l.radixSort();
+            DoublyLinkedList<int> r{};
+            while (l.getLength() > 0) { r.prepend(l.popFront()); }
+            l = std::move(r);
+        };
+        auto nearlySorted = [&] {
+            sorted();
+            for (int& v : l) {
+                if (rng() % 100 == 0) { v = static_cast<int>(rng() % 1'000'000); }
+            }
+        };
+        record("mergeSort (sorted)", n, measure(sorted, [&] { l.mergeSort(); }));
+        record("mergeSort (reversed)", n, measure(reversed, [&] { l.mergeSort(); }));
+        record("mergeSort (nearly sorted)", n, measure(nearlySorted, [&] { l.mergeSort(); }));
+
+        // short read-only windows: copied with the sub-list constructor,
+        // or referred to by a view; each window is summed once
+        std::vector<intmax_t> starts(WINDOWS);
+        for (intmax_t& start : starts) { start = rng() % n; }
+        record("sub-list copy (window)", WINDOWS, measure([] {}, [&] {
+            long long sum = 0;
+            for (intmax_t start : starts) {
+                DoublyLinkedList<int> window{l, start, WINDOW_LENGTH};
+                for (int v : window) { sum += v; }
+            }
+            sink = sink + sum;
+        }));
+        record("view (window)", WINDOWS, measure([] {}, [&] {
+            long long sum = 0;
+            for (intmax_t start : starts) {
+                ListView<int> window = l.view(start, WINDOW_LENGTH);
+                for (int v : window) { sum += v; }
+            }
+            sink = sink + sum;
+        }));
+
+        // walking a list whose nodes were scattered by prepends, pops and
+        // a relinking sort, before and after it is compacted
+        auto scattered = [&] {
+            Ops<List>::clear(l);
+            for (intmax_t i = 0; i < n; i++) {
+                int v = static_cast<int>(rng() % 1'000'000);
+                if (i % 2 == 0) { l.prepend(v); } else { l.append(v); }
+            }
+            for (intmax_t i = 0; i < n / 4; i++) { l.popFront(); }
+            for (intmax_t i = 0; i < n / 4; i++) { l.append(static_cast<int>(rng() % 1'000'000)); }
+            l.mergeSort();
+        };
+        auto walk = [&] {
+            long long sum = 0;
+            for (int v : l) { sum += v; }
+            sink = sink + sum;
+        };
+        scattered();
+        record("walk (scattered)", n, measure([] {}, walk));
+        record("compact", n, measure(scattered, [&] { l.compact(); }));
+        record("walk (compacted)", n, measure([] {}, walk));
+
+        // checkpointing to a binary file and loading it back
+        const std::string path{"/tmp/DoublyLinkedList-benchmark.bin"};
+        record("save", n, measure(refill, [&] { l.save(path); }));
+        record("load", n, measure([] {}, [&] { l.load(path); }));
+        std::remove(path.c_str());
+    }
+}
+
+// an object that already exists before it is put in a list; it can be
+// linked into an IntrusiveList by its hook, or into a DoublyLinkedList by
+// a pointer to it
+struct BenchItem : ListHook {
+    int value;
+    bool operator<(const BenchItem& other) const { return value < other.value; }
+};
+
+// a pointer to a BenchItem that compares the items it points to
+struct BenchItemRef {
+    BenchItem* item;
+    bool operator<(const BenchItemRef& other) const { return *item < *other.item; }
+};
+
+// time IntrusiveList, which links the objects themselves, against a
+// DoublyLinkedList that allocates a node pointing at each object
+static void benchIntrusive(intmax_t n, std::vector<Result>& results) {
+
+    std::vector<BenchItem> items(n);
+    std::mt19937 rng{5};
+    for (BenchItem& item : items) { item.value = static_cast<int>(rng() % 1'000'000); }
+
+    IntrusiveList<BenchItem> intrusive{};
+    DoublyLinkedList<BenchItemRef> pointers{};
+
+    // results of reads are added here so the compiler cannot skip them
+    volatile long long sink = 0;
+
+    auto record = [&](const char* container, const char* operation, double seconds) {
+        results.push_back(Result{container, operation, n, n, seconds});
+    };
+
+    // put every object in the list being timed, in the order of the vector
+    auto fillIntrusive = [&] {
+        intrusive.clear();
+        for (BenchItem& item : items) { intrusive.append(item); }
+    };
+    auto fillPointers = [&] {
+        pointers.clear();
+        for (BenchItem& item : items) { pointers.append(BenchItemRef{&item}); }
+    };
+
+    record("IntrusiveList", "append", measure([&] { intrusive.clear(); }, [&] {
+        for (BenchItem& item : items) { intrusive.append(item); }
+    }));
+    record("DoublyLinkedList<BenchItemRef>", "append", measure([&] { pointers.clear(); }, [&] {
+        for (BenchItem& item : items) { pointers.append(BenchItemRef{&item}); }
+    }));
+
+    record("IntrusiveList", "popFront", measure(fillIntrusive, [&] {
+        long long sum = 0;
+        while (!intrusive.isEmpty()) { sum += intrusive.popFront().value; }
+        sink = sink + sum;
+    }));
+    record("DoublyLinkedList<BenchItemRef>", "popFront", measure(fillPointers, [&] {
+        long long sum = 0;
+        while (pointers.getLength() > 0) { sum += pointers.popFront().item->value; }
+        sink = sink + sum;
+    }));
+
+    record("IntrusiveList", "mergeSort", measure(fillIntrusive, [&] { intrusive.mergeSort(); }));
+    record("DoublyLinkedList<BenchItemRef>", "mergeSort", measure(fillPointers, [&] { pointers.mergeSort(); }));
+
+    // walking the sorted lists, reading the value of every object
+    record("IntrusiveList", "walk (sorted)", measure([] {}, [&] {
+        long long sum = 0;
+        for (const BenchItem& item : intrusive) { sum += item.value; }
+        sink = sink + sum;
+    }));
+    record("DoublyLinkedList<BenchItemRef>", "walk (sorted)", measure([] {}, [&] {
+        long long sum = 0;
+        for (const BenchItemRef& ref : pointers) { sum += ref.item->value; }
+        sink = sink + sum;
+    }));
+
+    // the objects must leave the intrusive list before they are destroyed
+    intrusive.clear();
+}
+
+// ***************************************
+// Output
+
+static void printTable(std::ostream& out, const std::vector<Result>& results) {
+
+    out << std::left << std::setw(32) << "container" << std::setw(30) << "operation"
+        << std::right << std::setw(10) << "size" << std::setw(14) << "seconds"
+        << std::setw(14) << "ns/op" << "\n";
+
+    for (const Result& r : results) {
+        out << std::left << std::setw(32) << r.container << std::setw(30) << r.operation
+            << std::right << std::setw(10) << r.size << std::setw(14) << r.seconds
+            << std::setw(14) << (r.seconds / r.ops * 1e9) << "\n";
+    }
+}
+
+static void printCsv(std::ostream& out, const std::vector<Result>& results) {
+
+    out << "container,operation,size,ops,seconds,ns_per_op\n";
+
+    for (const Result& r : results) {
+        out << r.container << "," << r.operation << "," << r.size << "," << r.ops
+            << "," << r.seconds << "," << (r.seconds / r.ops * 1e9) << "\n";
+    }
+}
+
+static void printJson(std::ostream& out, const std::vector<Result>& results) {
+
+    out << "[\n";
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        out << "  {\"container\": \"" << r.container << "\", \"operation\": \""
+            << r.operation << "\", \"size\": " << r.size << ", \"ops\": " << r.ops
+            << ", \"seconds\": " << r.seconds << ", \"ns_per_op\": "
+            << (r.seconds / r.ops * 1e9) << "}" << ((i + 1 < results.size()) ? "," : "")
+            << "\n";
+    }
+
+    out << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+
+    // output format, largest list size and output file; set by arguments
+    std::string format{"table"};
+    intmax_t maxSize{10'000'000};
+    std::string outPath{};
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            format = "csv";
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            format = "json";
+        } else if ((std::strcmp(argv[i], "--max-size") == 0) && (i + 1 < argc)) {
+            maxSize = std::strtoll(argv[++i], nullptr, 10);
+        } else if ((std::strcmp(argv[i], "--out") == 0) && (i + 1 < argc)) {
+            outPath = argv[++i];
+        } else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--csv | --json] [--max-size N] [--out FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Result> results{};
+
+    for (intmax_t n = 1'000; n <= maxSize; n *= 10) {
+
+        // progress goes to stderr so it does not mix with the results
+        std::cerr << "benchmarking lists of " << n << " values" << std::endl;
+
+        benchContainer<DoublyLinkedList<int>>("DoublyLinkedList", n, results);
+        benchContainer<UnrolledDoublyLinkedList>("UnrolledDoublyLinkedList", n, results);
+        benchContainer<CompactDoublyLinkedList>("CompactDoublyLinkedList", n, results);
+        benchContainer<std::list<int>>("std::list", n, results);
+        benchContainer<std::vector<int>>("std::vector", n, results);
+        benchIntrusive(n, results);
+    }
+
+    // write the results to the output file, or to stdout
+    std::ofstream outFile{};
+    if (!outPath.empty()) {
+        outFile.open(outPath);
+        if (!outFile) {
+            std::cerr << "could not open " << outPath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& out = outPath.empty() ? std::cout : outFile;
+
+    if (format == "csv") {
+        printCsv(out, results);
+    } else if (format == "json") {
+        printJson(out, results);
+    } else {
+        out << "memory per value: DoublyLinkedList " << sizeof(Node<int>)
+            << " bytes, UnrolledDoublyLinkedList "
+            << static_cast<double>(sizeof(UnrolledNode)) / UNROLLED_NODE_CAPACITY
+            << " bytes, CompactDoublyLinkedList " << sizeof(CompactNode) << " bytes; " << std::thread::hardware_concurrency()
+            << " hardware threads\n\n";
+        printTable(out, results);
+    }
+
+#ifdef DLL_INSTRUMENT
+    // built with `make bench INSTRUMENT=1`: report what the list operations
+    // did during the whole run
+    std::cerr << std::endl;
+    printListStats(std::cerr, listStats());
+#endif
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+Checks that ConcurrentDeque loses and duplicates no values when many
+threads use it at once, then compares its throughput as a producer /
+consumer work queue with a DoublyLinkedList wrapped in one mutex.
+Usage: concurrentBenchmark [values per producer]
+*/
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <memory>
+
+#include "ConcurrentDeque.h"
+#include "DoublyLinkedList.h"
+
+// a DoublyLinkedList behind one global mutex; the way the list was shared
+// between threads before ConcurrentDeque existed
+class MutexList {
+public:
+    void append(int v) { std::lock_guard<std::mutex> lock{m}; l.append(v); };
+    void prepend(int v) { std::lock_guard<std::mutex> lock{m}; l.prepend(v); };
+    bool tryPopFront(int& out) {
+        std::lock_guard<std::mutex> lock{m};
+        if (l.getLength() == 0) {
+            return false;
+        }
+        out = l.popFront();
+        return true;
+    };
+private:
+    std::mutex m;
+    DoublyLinkedList<int> l;
+};
+
+// run `producers` threads that each add `perProducer` values and
+// `consumers` threads that pop until every value has been taken; every
+// value encodes its producer and sequence number; producers prepend every
+// other value if `mixed` is true; returns the number of seconds taken and
+// exits if a value was lost, duplicated, or (when not mixed) a consumer
+// saw one producer's values out of order
+template <typename Queue>
+static double runWorkload(int producers, int consumers, int perProducer, bool mixed) {
+
+    Queue queue{};
+
+    const long long total = static_cast<long long>(producers) * perProducer;
+
+    // number of times each value was popped, and values popped in total
+    std::unique_ptr<std::atomic<unsigned char>[]> seen{new std::atomic<unsigned char>[total]};
+    for (long long i = 0; i < total; i++) { seen[i].store(0, std::memory_order_relaxed); }
+    std::atomic<long long> popped{0};
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> threads{};
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < perProducer; i++) {
+                int v = p * perProducer + i;
+                if (mixed && (i % 2 == 1)) {
+                    queue.prepend(v);
+                } else {
+                    queue.append(v);
+                }
+            }
+        });
+    }
+
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+
+            // the last sequence number this consumer saw from each producer
+            std::vector<int> lastSeen(producers, -1);
+
+            int v = 0;
+            while (popped.load(std::memory_order_relaxed) < total) {
+
+                if (!queue.tryPopFront(v)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                popped.fetch_add(1, std::memory_order_relaxed);
+
+                // every value must be popped exactly once
+                if (seen[v].fetch_add(1, std::memory_order_relaxed) != 0) {
+                    failed = true;
+                }
+
+                // values appended by one producer come out in order
+                int p = v / perProducer;
+                int i = v % perProducer;
+                if (!mixed && (i <= lastSeen[p])) {
+                    failed = true;
+                }
+                lastSeen[p] = i;
+            }
+        });
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    // every value must have been popped
+    for (long long i = 0; i < total; i++) {
+        if (seen[i].load(std::memory_order_relaxed) != 1) {
+            failed = true;
+        }
+    }
+
+    if (failed) {
+        std::cerr << "values were lost, duplicated or reordered with " << producers
+                  << " producers and " << consumers << " consumers" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+
+    // number of values each producer adds
+    int perProducer = (argc > 1) ? std::atoi(argv[1]) : 200'000;
+
+    // stress: uneven numbers of producers and consumers, with and without
+    // prepending, on both queues
+    for (int producers : {1, 3, 8}) {
+        for (int consumers : {1, 4, 7}) {
+            runWorkload<ConcurrentDeque<int>>(producers, consumers, perProducer / 10, false);
+            runWorkload<ConcurrentDeque<int>>(producers, consumers, perProducer / 10, true);
+            runWorkload<MutexList>(producers, consumers, perProducer / 10, true);
+        }
+    }
+    std::cout << "stress test passed" << std::endl << std::endl;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads; "
+              << perProducer << " values per producer" << std::endl;
+    std::cout << std::left << std::setw(10) << "threads" << std::right
+              << std::setw(20) << "MutexList (M/s)" << std::setw(24)
+              << "ConcurrentDeque (M/s)" << std::setw(10) << "speedup" << std::endl;
+
+    // throughput: equal numbers of producers and consumers
+    for (int threads : {2, 4, 8, 16, 32}) {
+
+        int pairs = threads / 2;
+        double values = static_cast<double>(pairs) * perProducer;
+
+        double mutexSeconds = runWorkload<MutexList>(pairs, pairs, perProducer, false);
+        double dequeSeconds = runWorkload<ConcurrentDeque<int>>(pairs, pairs, perProducer, false);
+
+        std::cout << std::left << std::setw(10) << threads << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(20) << (values / mutexSeconds / 1e6)
+                  << std::setw(24) << (values / dequeSeconds / 1e6) << std::setw(9)
+                  << (mutexSeconds / dequeSeconds) << "x" << std::endl;
+    }
+
+    return 0;
+}
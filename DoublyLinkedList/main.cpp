@@ -8,11 +8,14 @@ int main() {
         
     srand(time(NULL));
 
-    DoublyLinkedList myList{};
-    
+    DoublyLinkedList<int> myList{};
+
+    // fill the list with random values, all linked in at once
+    int values[1'000];
     for (int i = 0; i < 1'000; i++) {
-        myList.append(rand() % 10);
+        values[i] = rand() % 10;
     }
+    myList.append(values, values + 1'000);
 
     std::cout << "Value of idx 999 is "
               << myList.at(999) << "." << std::endl;
@@ -0,0 +1,36 @@
+#ifndef PLANERULES_H
+#define PLANERULES_H
+
+#include <cstdint>
+
+// how a plane burns fuel; shared by the planes that fly as child processes
+// and the planes of the in-process simulation (PlaneSim.h)
+
+// fuel obtained upon launch and refuel
+const int FUEL_MAX{100};
+
+// a plane uses FUEL_PER_TICK units of fuel every TICK_SECONDS seconds
+const int FUEL_PER_TICK{5};
+const int TICK_SECONDS{3};
+
+// a plane sends a notice of its fuel level when it has less than LOW_FUEL
+// units left, at most once every NOTICE_SECONDS seconds
+const int LOW_FUEL{50};
+const int NOTICE_SECONDS{9};
+
+// seconds after a refuel at which the fuel level first drops below
+// LOW_FUEL (33), and at which the plane runs out of fuel and crashes (60)
+const int LOW_FUEL_SECONDS{((FUEL_MAX - LOW_FUEL) / FUEL_PER_TICK + 1) * TICK_SECONDS};
+const int EMPTY_SECONDS{((FUEL_MAX + FUEL_PER_TICK - 1) / FUEL_PER_TICK) * TICK_SECONDS};
+
+// nanoseconds in one second
+const int64_t NANOSECONDS_PER_SECOND{1'000'000'000};
+
+// return the fuel level of a plane the supplied number of nanoseconds
+// after its last refuel
+inline int fuelAfter(int64_t nanosecondsSinceRefuel) {
+    int64_t ticks = nanosecondsSinceRefuel / (TICK_SECONDS * NANOSECONDS_PER_SECOND);
+    return FUEL_MAX - (static_cast<int>(ticks) * FUEL_PER_TICK);
+}
+
+#endif
@@ -0,0 +1,185 @@
+#include <stdexcept>
+
+#include "PlaneSim.h"
+
+// CONSTRUCTOR
+PlaneSim::PlaneSim(unsigned workerCount)
+        : ids{}, lastRefuelTimes{}, lastNoticeTimes{}, timers{}, slots{SIM_NO_SLOT},
+          wheel{}, expired{}, expiredDeadlines{}, workerNotices{}, workers{workerCount} {
+
+    // ID 0 (SIM_NO_PLANE) is never used, so the slot array starts with an
+    // empty entry for it
+
+    // every worker collects its own notices, so they never share a vector
+    workerNotices.resize(workers.getWorkerCount());
+}
+
+uint32_t PlaneSim::launch(int64_t now, std::size_t count) {
+
+    // IDs and slots are 32 bits, and the largest value is kept for
+    // SIM_NO_SLOT
+    if (count >= SIM_NO_SLOT - slots.size()) {
+        throw std::overflow_error{"PlaneSim launched too many planes"};
+    }
+
+    // a wheel with no timers has nothing to hand back, so it is turned
+    // straight to `now`; otherwise, the first launch would leave the wheel
+    // at tick 0 with every timer far beyond its reach
+    if (wheel.getTimerCount() == 0) {
+        wheel.advance(static_cast<uint64_t>(now / SIM_TICK_NANOSECONDS), expired);
+    }
+
+    uint32_t firstId = static_cast<uint32_t>(slots.size());
+    uint32_t firstSlot = static_cast<uint32_t>(ids.size());
+
+    // the first deadline of a plane with a full tank is its first low fuel
+    // notice, which is the same for every plane launched at once
+    uint64_t firstTick = tickAtOrAfter(now + (LOW_FUEL_SECONDS * NANOSECONDS_PER_SECOND));
+
+    // every new plane goes in the slot after the last plane, with a full
+    // tank; its notice clock starts at launch
+    ids.reserve(ids.size() + count);
+    slots.reserve(slots.size() + count);
+    timers.reserve(timers.size() + count);
+    for (std::size_t i = 0; i < count; i++) {
+        uint32_t id = firstId + static_cast<uint32_t>(i);
+        ids.push_back(id);
+        slots.push_back(firstSlot + static_cast<uint32_t>(i));
+        timers.push_back(wheel.schedule(firstTick, id));
+    }
+    lastRefuelTimes.resize(ids.size(), now);
+    lastNoticeTimes.resize(ids.size(), now);
+
+    return firstId;
+}
+
+bool PlaneSim::refuel(uint32_t id, int64_t now) {
+
+    uint32_t slot = slotOf(id);
+    if (slot == SIM_NO_SLOT) {
+        return false;
+    }
+
+    // reset the fuel level to max by recording the refuel time, and move
+    // the plane's timer to its new deadline
+    lastRefuelTimes[slot] = now;
+    wheel.cancel(timers[slot]);
+    timers[slot] = wheel.schedule(tickAtOrAfter(nextDeadline(slot)), id);
+
+    return true;
+}
+
+void PlaneSim::advance(int64_t now, std::vector<SimNotice>& notices,
+                       std::vector<uint32_t>& crashes) {
+
+    // the planes whose deadline has come, in order of deadline
+    expired.clear();
+    wheel.advance(static_cast<uint64_t>(now / SIM_TICK_NANOSECONDS), expired);
+    if (expired.empty()) {
+        return;
+    }
+    expiredDeadlines.resize(expired.size());
+
+    // the arrays are read through raw pointers, so the loop below does not
+    // have to assume that writing one field could change another vector
+    const uint32_t* idArray = expired.data();
+    const uint32_t* slotArray = slots.data();
+    const int64_t* refuelArray = lastRefuelTimes.data();
+    int64_t* noticeArray = lastNoticeTimes.data();
+    int64_t* deadlineArray = expiredDeadlines.data();
+
+    // each worker handles a contiguous range of the planes whose timers
+    // went off; every plane is in one range, so the workers never write
+    // the same slot
+    workers.parallelFor(expired.size(), [&](std::size_t begin, std::size_t end, unsigned worker) {
+
+        std::vector<SimNotice>& foundNotices = workerNotices[worker];
+
+        for (std::size_t i = begin; i < end; i++) {
+
+            uint32_t slot = slotArray[idArray[i]];
+            int64_t sinceRefuel = now - refuelArray[slot];
+
+            // the plane has run out of fuel
+            if (sinceRefuel >= EMPTY_SECONDS * NANOSECONDS_PER_SECOND) {
+                deadlineArray[i] = -1;
+                continue;
+            }
+
+            // a notice is due once the fuel level is below LOW_FUEL and
+            // NOTICE_SECONDS have passed since the last notice
+            int level = fuelAfter(sinceRefuel);
+            if ((level < LOW_FUEL) &&
+                (now - noticeArray[slot] >= NOTICE_SECONDS * NANOSECONDS_PER_SECOND)) {
+                noticeArray[slot] = now;
+                foundNotices.push_back(SimNotice{idArray[i], level});
+            }
+
+            deadlineArray[i] = nextDeadline(slot);
+        }
+    });
+
+    // gather the notices of every worker
+    for (std::vector<SimNotice>& foundNotices : workerNotices) {
+        notices.insert(notices.end(), foundNotices.begin(), foundNotices.end());
+        foundNotices.clear();
+    }
+
+    // the wheel is only changed by one thread; set a timer for the next
+    // deadline of every plane still flying, and remove the crashed planes
+    for (std::size_t i = 0; i < expired.size(); i++) {
+
+        uint32_t id = expired[i];
+        if (expiredDeadlines[i] < 0) {
+            crashes.push_back(id);
+            removeSlot(slots[id]);
+        } else {
+            timers[slots[id]] = wheel.schedule(tickAtOrAfter(expiredDeadlines[i]), id);
+        }
+    }
+}
+
+std::size_t PlaneSim::getMemoryUsage(void) const {
+
+    return ids.capacity() * sizeof(uint32_t) +
+           lastRefuelTimes.capacity() * sizeof(int64_t) +
+           lastNoticeTimes.capacity() * sizeof(int64_t) +
+           timers.capacity() * sizeof(uint32_t) +
+           slots.capacity() * sizeof(uint32_t) + wheel.getMemoryUsage();
+}
+
+int64_t PlaneSim::nextDeadline(uint32_t slot) const {
+
+    // the next notice is due once the fuel level is below LOW_FUEL and
+    // NOTICE_SECONDS have passed since the last notice; the plane crashes
+    // once it runs out of fuel
+    int64_t noticeTime = lastRefuelTimes[slot] + (LOW_FUEL_SECONDS * NANOSECONDS_PER_SECOND);
+    if (noticeTime < lastNoticeTimes[slot] + (NOTICE_SECONDS * NANOSECONDS_PER_SECOND)) {
+        noticeTime = lastNoticeTimes[slot] + (NOTICE_SECONDS * NANOSECONDS_PER_SECOND);
+    }
+    int64_t crashTime = lastRefuelTimes[slot] + (EMPTY_SECONDS * NANOSECONDS_PER_SECOND);
+
+    return (noticeTime < crashTime) ? noticeTime : crashTime;
+}
+
+void PlaneSim::removeSlot(uint32_t slot) {
+
+    uint32_t last = static_cast<uint32_t>(ids.size() - 1);
+
+    // the plane is no longer in the sky
+    slots[ids[slot]] = SIM_NO_SLOT;
+
+    // move the last plane into the slot, field by field
+    if (slot != last) {
+        ids[slot] = ids[last];
+        lastRefuelTimes[slot] = lastRefuelTimes[last];
+        lastNoticeTimes[slot] = lastNoticeTimes[last];
+        timers[slot] = timers[last];
+        slots[ids[slot]] = slot;
+    }
+
+    ids.pop_back();
+    lastRefuelTimes.pop_back();
+    lastNoticeTimes.pop_back();
+    timers.pop_back();
+}
@@ -0,0 +1,145 @@
+#ifndef PLANESIM_H
+#define PLANESIM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PlaneRules.h"
+#include "TimingWheel.h"
+#include "WorkerPool.h"
+
+// plane ID that does not refer to any plane
+const uint32_t SIM_NO_PLANE{0};
+
+// slot of a plane that is not in the sky
+const uint32_t SIM_NO_SLOT{UINT32_MAX};
+
+// length of one tick of the simulation's timing wheel; a plane's notices
+// and crash happen at the first tick at or after they are due
+const int64_t SIM_TICK_NANOSECONDS{100'000'000};
+
+// a low fuel notice from a simulated plane
+struct SimNotice {
+    uint32_t id;
+    int fuel;
+};
+
+// a Plane Sim flies planes as records inside one process instead of as
+// child processes, so a launch costs a few dozen bytes rather than a fork();
+// the planes burn fuel by the same rules (PlaneRules.h), and a refuel,
+// bomb or crash means the same as it does for a child process;
+// the planes are kept in struct-of-arrays layout: one array per field,
+// with the live planes packed at the front of every array; a crashed
+// plane's slot is filled with the last plane;
+// every plane has one timer in a Timing Wheel, set to its next deadline
+// (its next low fuel notice or its crash), so advance() only touches the
+// planes whose deadline has come; the planes of a batch are shared
+// between the threads of a Worker Pool;
+// times are on the monotonic clock in nanoseconds, and are supplied by
+// the caller, so the simulation can be run faster than real time
+class PlaneSim {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    PlaneSim(const PlaneSim&) = delete;
+    PlaneSim& operator=(const PlaneSim&) = delete;
+    PlaneSim(PlaneSim&&) = delete;
+    PlaneSim& operator=(PlaneSim&&) = delete;
+
+public:
+
+    // constructor method for a simulation with no planes; advance() is
+    // shared between `workerCount` threads (see WorkerPool)
+    explicit PlaneSim(unsigned workerCount = 0);
+
+    // return the number of planes in the sky
+    std::size_t getPlaneCount(void) const { return ids.size(); };
+
+    // return the number of threads that move the planes
+    unsigned getWorkerCount(void) const { return workers.getWorkerCount(); };
+
+    // return the IDs of the planes in the sky, in no particular order
+    const std::vector<uint32_t>& getIds(void) const { return ids; };
+
+    // return true if the plane with the supplied ID is in the sky
+    bool isFlying(uint32_t id) const { return slotOf(id) != SIM_NO_SLOT; };
+
+    // return the fuel level at time `now` of the plane with the supplied
+    // ID; the plane must be in the sky
+    int getFuel(uint32_t id, int64_t now) const {
+        return fuelAfter(now - lastRefuelTimes[slotOf(id)]);
+    };
+
+    // launch `count` planes with full tanks at time `now`; returns the ID
+    // of the first one, the others have the IDs that follow it; IDs are
+    // never reused; throws overflow_error once 2^32 - 1 planes have been
+    // launched
+    uint32_t launch(int64_t now, std::size_t count = 1);
+
+    // fill the tank of the plane with the supplied ID at time `now`, and
+    // move its timer to its new deadline in O(1); returns false if there
+    // is no such plane
+    bool refuel(uint32_t id, int64_t now);
+
+    // drop a bomb from the plane with the supplied ID; returns false if
+    // there is no such plane
+    bool bomb(uint32_t id) const { return isFlying(id); };
+
+    // move the simulation up to time `now`: add a notice to `notices` for
+    // every plane with a notice due, and remove every plane that has run
+    // out of fuel, adding its ID to `crashes`; only the planes whose
+    // timers go off are looked at
+    void advance(int64_t now, std::vector<SimNotice>& notices,
+                 std::vector<uint32_t>& crashes);
+
+    // return the number of bytes of memory held by the planes and timers
+    std::size_t getMemoryUsage(void) const;
+
+private:
+
+    // return the slot of the plane with the supplied ID, or SIM_NO_SLOT
+    uint32_t slotOf(uint32_t id) const {
+        return (id < slots.size()) ? slots[id] : SIM_NO_SLOT;
+    };
+
+    // return the time of the next deadline of the plane in the supplied
+    // slot: its next low fuel notice or its crash, whichever is first
+    int64_t nextDeadline(uint32_t slot) const;
+
+    // return the first tick of the timing wheel at or after `time`
+    static uint64_t tickAtOrAfter(int64_t time) {
+        return static_cast<uint64_t>((time + SIM_TICK_NANOSECONDS - 1) / SIM_TICK_NANOSECONDS);
+    };
+
+    // fill the supplied slot with the plane in the last slot
+    void removeSlot(uint32_t slot);
+
+    // the fields of the planes, one array each, indexed by slot; `timers`
+    // holds the handle of the plane's timer
+    std::vector<uint32_t> ids;
+    std::vector<int64_t> lastRefuelTimes;
+    std::vector<int64_t> lastNoticeTimes;
+    std::vector<uint32_t> timers;
+
+    // the slot of every plane ever launched, indexed by ID; SIM_NO_SLOT once
+    // the plane has crashed; ID 0 is never used
+    std::vector<uint32_t> slots;
+
+    // the timer of every plane; a timer's payload is the plane's ID
+    TimingWheel wheel;
+
+    // the IDs of the planes whose timers went off during advance(), and
+    // the next deadline of each of them, or -1 if it crashed; kept between
+    // calls so their memory is reused
+    std::vector<uint32_t> expired;
+    std::vector<int64_t> expiredDeadlines;
+
+    // notices found by each worker during advance()
+    std::vector<std::vector<SimNotice>> workerNotices;
+
+    // the threads that move the planes
+    WorkerPool workers;
+};
+
+#endif
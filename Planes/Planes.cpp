@@ -10,129 +10,348 @@ On: 10-31-2020
 */
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include <stdexcept>
 #include <ctime>
+#include <cstdint>
+#include <cerrno>
+#include <climits>
 #include <unistd.h>
 #include <signal.h>
 #include <sys/wait.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+
+#include "PlaneRules.h"
+#include "PlaneSim.h"
 
-using std::cin;
 using std::cout;
 using std::endl;
 using std::flush;
 using std::string;
-using std::getline;
+using std::unordered_map;
 using std::vector;
 
 // commands available to the user
 // `quit` is also acceptable but is handled differently
 enum commands{HELP, STATUS, LAUNCH, REFUEL, BOMB, INVALID_CMD};
 
-// global flags to indicate whether signals have been received
-int refuelFlag = 0;
-int bombFlag = 0;
+// most simulated planes printed one by one by the status command
+const std::size_t SIM_STATUS_MAX{100};
+
+// signal that carries a command from the parent to a plane, and signal a
+// plane sends the parent upon running out of fuel; real-time signals are
+// queued one by one instead of being merged with a pending signal of the
+// same kind, so none of them are lost, and they carry a value
+const int COMMAND_SIGNAL{SIGRTMIN};
+const int CRASH_SIGNAL{SIGRTMIN + 1};
+
+// commands sent to a plane; the value of COMMAND_SIGNAL holds the command
+// in its low COMMAND_BITS bits and a count (e.g. of bombs) in the rest
+enum planeCommands{REFUEL_PLANE = 1, BOMB_PLANE = 2};
+const int COMMAND_BITS{4};
+const int COMMAND_COUNT_MAX{INT_MAX >> COMMAND_BITS};
+
+// the number of real-time signals waiting to be read is limited
+// (RLIMIT_SIGPENDING); while the limit is reached, a command is tried
+// again every SEND_RETRY_NANOSECONDS, up to SEND_ATTEMPTS times
+const int SEND_ATTEMPTS{1'000};
+const long SEND_RETRY_NANOSECONDS{1'000'000};
+
+// the parent's record of a live plane (child process)
+struct Plane {
+
+    // process ID of the plane
+    pid_t id;
+
+    // time the plane was launched on the monotonic clock in nanoseconds
+    int64_t launchTime;
+};
+
+// prints a special message if there are no planes; otherwise, prints the
+// ID of each plane and the seconds it has been flying; only reads the
+// fleet, so it makes no system calls however many planes are flying
+void printStatus(const unordered_map<pid_t, Plane>& fleet);
+
+// parse a line of user input into a command, an ID and a count (of
+// planes for LAUNCH, of bombs for BOMB); returns 0 if `quit` command is
+// received; otherwise, 1
+int parseInput(const string& input, commands& cmd, pid_t& id, int& count);
+
+// send a command to a plane as the value of a queued COMMAND_SIGNAL;
+// waits while the queue of pending signals is full; returns false if the
+// command could not be sent
+bool sendCommand(pid_t plane, planeCommands command, int count);
+
+// send CRASH_SIGNAL from a plane to `parent`, which must still be the
+// plane's parent; waits while the queue of pending signals is full like
+// sendCommand(); returns false if the crash could not be reported
+bool sendCrash(pid_t parent);
+
+// add stdin to the epoll instance, so epoll_wait() returns when there is
+// user input; returns false if epoll cannot watch stdin because it is a
+// regular file (e.g. a script redirected to stdin), which is always ready
+// to be read, in which case the caller reads it on every pass instead
+bool watchInput(int epollFd);
+
+// read the input that is ready on stdin onto the end of `pendingInput`;
+// at EOF, ends a last line that has no newline; returns false at EOF once
+// every line has been taken
+bool readInput(string& pendingInput);
+
+// move the first whole line of `pendingInput` into `line`, without its
+// newline; returns false if there is no whole line yet
+bool takeLine(string& pendingInput, string& line);
+
+// print the list of commands
+void printHelp(void);
+
+// runs the `--sim` mode: the planes are records in a PlaneSim instead of
+// child processes, and one timerfd turns the timing wheel that holds all
+// of their deadlines every SIM_TICK_NANOSECONDS; takes the same commands
+// as the child process mode
+int flySimulation(void);
+
+// prints a special message if there are no simulated planes; otherwise,
+// prints how many there are, and the ID and fuel level of each of them if
+// there are no more than SIM_STATUS_MAX
+void printSimStatus(const PlaneSim& sim);
+
+// reaps every terminated child process (plane) and removes it from the
+// fleet; signals of one kind do not queue, so a single SIGCHLD can stand
+// for any number of terminated children
+void reapChildren(unordered_map<pid_t, Plane>& fleet);
+
+// runs in the child process (plane) until it runs out of fuel; the plane
+// sleeps in epoll_wait() until its next event: a deadline on a timerfd
+// (the next low fuel notice, or running out of fuel), or a signal from the
+// parent read from a signalfd (COMMAND_SIGNAL to refuel or bomb, SIGTERM
+// to terminate); the signals must already be blocked
+void flyPlane(const sigset_t& planeSignals);
+
+// return the time on the monotonic clock in nanoseconds
+int64_t monotonicNow(void);
+
+// print the message of a plane dropping `count` bombs, without a newline
+void printBombs(long id, int count);
 
-// prints a special message if an empty vector is passed otherwise, 
-// prints the values held in the vector; values are child process (plane) IDs 
-void printStatus(const vector<pid_t>& listOfPlanes);
+// close all child processes
+void closeChildren(const unordered_map<pid_t, Plane>& fleet);
 
-// prompt and wait for user input; then parse it
-// returns 0 if `quit` command or `EOF` is received; otherwise, 1
-int parseInput(commands& cmd, pid_t& id);
+int main(int argc, char* argv[]) {
 
-// removes terminated child processes from the list of child processes
-void removeDeadChildren(vector<pid_t>& children);
+    // `--sim` flies the planes inside this process
+    if ((argc > 1) && (string{argv[1]} == "--sim")) {
+        return flySimulation();
+    }
 
-// sets refuel flag to 1 upon receiving SIGUSR2 from the parent process
-void refuelHandler(int signum);
+    // signals read by the parent from its signalfd: SIGCHLD when a plane
+    // terminates, and CRASH_SIGNAL from a plane upon running out of fuel
+    sigset_t baseSignals;
+    sigemptyset(&baseSignals);
+    sigaddset(&baseSignals, SIGCHLD);
+    sigaddset(&baseSignals, CRASH_SIGNAL);
+    sigprocmask(SIG_BLOCK, &baseSignals, nullptr);
+
+    // signals sent by the parent to a plane; blocked in the plane and read
+    // from its signalfd
+    sigset_t planeSignals;
+    sigemptyset(&planeSignals);
+    sigaddset(&planeSignals, COMMAND_SIGNAL);
+    sigaddset(&planeSignals, SIGTERM);
+
+    // the parent's signal mask while a plane is being launched
+    sigset_t parentSignals;
+
+    // process ID of the parent; a plane only reports its crash to this
+    // process, never to whichever process adopts it if the parent dies
+    pid_t parentID = getpid();
+
+    // the parent sleeps in epoll_wait() until there is user input or a
+    // signal, so planes are reaped as soon as they terminate
+    int signalFd = signalfd(-1, &baseSignals, SFD_CLOEXEC | SFD_NONBLOCK);
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if ((signalFd == -1) || (epollFd == -1)) {
+        perror("could not set up base");
+        exit(EXIT_FAILURE);
+    }
 
-// sets bomb flag to 1 upon receiving SIGUSR1 from the parent process
-void bombHandler(int signum);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = signalFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, signalFd, &event) == -1) {
+        perror("could not set up base");
+        exit(EXIT_FAILURE);
+    }
+    bool inputWatched = watchInput(epollFd);
 
-// print a message if SIGUSR2 is received from a child process
-void childCrashHandler(int signum);
+    // holders for user's desired command and id after being parsed
+    commands command;
+    pid_t commandID;
+    int commandCount;
 
-// calculate the difference (in seconds) between two times
-double getTimeDifference(timespec& begin, timespec& end);
+    // every live plane by process ID; planes are added upon launch and
+    // removed upon being reaped, both in O(1)
+    unordered_map<pid_t, Plane> fleet{};
 
-// children processes terminate upon receiving SIGTERM from parent process
-void childTerminateHandler(int signum);
+    // input read from stdin that does not yet make up a whole line
+    string pendingInput{};
 
-// close all child processes
-void closeChildren(const vector<pid_t>& children);
+    // false once the user wants to quit (i.e. program receives `quit`
+    // or EOF from stdin)
+    bool running = true;
 
-int main(int argc, char* argv[]) {
+    // prompt the user for the first command
+    cout << "Command: " << flush;
 
-    // child sends SIGUSR2 to parent upon running out of fuel
-    signal(SIGUSR2, childCrashHandler);
+    while (running) {
 
-    // holders for user's desired command and id after being parsed
-    commands command;
-    pid_t commandID;
-    
-    // list of process IDs for child processes (planes)
-    vector<pid_t> planesList{};
+        // sleep until there is user input or a signal; if a whole line of
+        // input is already waiting, or stdin cannot be watched, only check
+        // for signals so they are handled between commands
+        bool lineWaiting = (pendingInput.find('\n') != string::npos);
+        int timeout = (lineWaiting || !inputWatched) ? 0 : -1;
 
-    // holds the process ID for the most recently created child initialized
-    // to non-zero value to indicate this is the parent process
-    pid_t currentPlaneID = 1;
+        epoll_event ready[2];
+        int readyCount = epoll_wait(epollFd, ready, 2, timeout);
+        if (readyCount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("could not wait for events");
+            exit(EXIT_FAILURE);
+        }
 
-    // loop until user wants to quit (i.e. program receives `quit`
-    // or EOF from stdin is interpreted); loop terminates if run by a child
-    // process (i.e. currentPlaneID == 0)
-    while ((currentPlaneID != 0) && parseInput(command, commandID)) {
+        // stdin that cannot be watched is always ready to be read
+        bool inputReady = !inputWatched;
 
-        // remove dead child processes (crashed planes) from the planes list
-        removeDeadChildren(planesList);
+        for (int i = 0; i < readyCount; i++) {
+
+            if (ready[i].data.fd == STDIN_FILENO) {
+                inputReady = true;
+                continue;
+            }
+
+            // handle every signal sent to the parent; every crash is queued
+            // as its own signal, so many signals are read at once
+            signalfd_siginfo infos[64];
+            ssize_t bytesRead;
+            while ((bytesRead = read(signalFd, infos, sizeof(infos))) > 0) {
+
+                for (size_t k = 0; k < bytesRead / sizeof(signalfd_siginfo); k++) {
+
+                    // one or more planes have terminated
+                    if (infos[k].ssi_signo == SIGCHLD) {
+                        reapChildren(fleet);
+                    }
+                    // a plane has run out of fuel
+                    else if (static_cast<int>(infos[k].ssi_signo) == CRASH_SIGNAL) {
+                        cout << "SOS! Plane " << infos[k].ssi_pid
+                             << " has crashed!\nCommand: " << flush;
+                    }
+                }
+            }
+        }
+
+        // read more input once every whole line read so far has been run;
+        // EOF ends the program
+        if (inputReady && !lineWaiting && !readInput(pendingInput)) {
+            cout << endl;
+            running = false;
+            continue;
+        }
+
+        // run a command for the next whole line of input, if there is one
+        string input;
+        if (!takeLine(pendingInput, input)) {
+            continue;
+        }
+
+        // do nothing more if the user would like to end the program
+        if (!parseInput(input, command, commandID, commandCount)) {
+            running = false;
+            continue;
+        }
+
+        // holds the process ID of a newly created child
+        pid_t currentPlaneID;
 
         switch (command) {
 
             // print commands
             case HELP:
-                cout << "Commands:\n"
-                     << "s\t= status: prints out the IDs of all live planes\n"
-                     << "l\t= launch: launches a new plane\n"
-                     << "r <id>\t= refuel: refuels the plane with the specified ID\n"
-                     << "b <id>\t= bomb: drop a bomb from the plane with the specified ID\n"
-                     << "q\t= quit: quit the program\n";
+                printHelp();
                 break;
 
             // print IDs of current children (planes)
             case STATUS:
-                printStatus(planesList);
+                printStatus(fleet);
                 break;
 
-            // create a new child process (plane)
+            // create new child processes (planes)
             case LAUNCH:
 
-                // create a child process and stores its process ID
-                currentPlaneID = fork();
-
-                // fork() returns negative value upon error
-                if (currentPlaneID < 0) {
-                    cout << "There was a problem launching!" << endl;
-                }
-                // fork() returns the child process ID to the parent process
-                else if (currentPlaneID > 0) {
-
-                    // store the ID in the list of children (planes)
-                    planesList.push_back(currentPlaneID);
+                // launch `commandCount` planes, one child process each
+                for (int i = 0; i < commandCount; i++) {
+
+                    // block the signals the plane reads from its signalfd
+                    // before forking, so a signal sent to the plane before
+                    // it has set up the signalfd waits for it instead of
+                    // killing it
+                    sigprocmask(SIG_BLOCK, &planeSignals, &parentSignals);
+
+                    // create a child process and stores its process ID
+                    currentPlaneID = fork();
+
+                    // fork() returns 0 to the child process; the plane
+                    // has no use for the parent's descriptors, and flies
+                    // until it runs out of fuel, then sends CRASH_SIGNAL
+                    // to the parent
+                    if (currentPlaneID == 0) {
+                        close(epollFd);
+                        close(signalFd);
+                        flyPlane(planeSignals);
+                        sendCrash(parentID);
+                        exit(EXIT_SUCCESS);
+                    }
+
+                    // the parent goes back to its own signal mask
+                    sigprocmask(SIG_SETMASK, &parentSignals, nullptr);
+
+                    // fork() returns negative value upon error; the
+                    // rest of the planes are not launched either
+                    if (currentPlaneID < 0) {
+                        cout << "There was a problem launching!" << endl;
+                        break;
+                    }
+
+                    // fork() returns the child process ID to the parent
+                    // process; add the plane to the fleet
+                    fleet[currentPlaneID] = Plane{currentPlaneID, monotonicNow()};
                 }
-                // fork() returns 0 to the child process; in this case,
-                // do nothing, the while loop will terminate and child
-                // code in the while loop below will execute
-                // else {}
 
                 break; // end of LAUNCH case
 
-            // send SIGUSR2 (refuel) signal to child process
+            // send the refuel command to child process
             case REFUEL:
-                kill(commandID, SIGUSR2);
+                if (fleet.count(commandID) == 0) {
+                    cout << "There is no plane with ID " << commandID << endl;
+                } else if (!sendCommand(commandID, REFUEL_PLANE, 1)) {
+                    cout << "Could not reach plane " << commandID << endl;
+                }
                 break;
 
-            // send SIGUSR1 (bomb) signal to child process
+            // send the bomb command, with the number of bombs, to
+            // child process
             case BOMB:
-                kill(commandID, SIGUSR1);
+                if (fleet.count(commandID) == 0) {
+                    cout << "There is no plane with ID " << commandID << endl;
+                } else if (!sendCommand(commandID, BOMB_PLANE, commandCount)) {
+                    cout << "Could not reach plane " << commandID << endl;
+                }
                 break;
 
             // print a message if and invalid command is given
@@ -144,128 +363,32 @@ int main(int argc, char* argv[]) {
             // should never happen, but if it does, it would be good to know
             // that it happened
             default:
-                cout << "If this line is printed, and error has occured." 
+                cout << "If this line is printed, and error has occured."
                      << endl;
                 break;
         }
-    }
-
-    // child process code
-    if (currentPlaneID == 0) {
-
-        // direct signal SIGTERM to the child terminate handler
-        signal(SIGTERM, childTerminateHandler);
-
-        // direct signals SIGUSR1 and SIGUSR2 to the appropriate handlers
-        // each handler sets a flag to 1 upon being called
-        signal(SIGUSR2, refuelHandler);
-        signal(SIGUSR1, bombHandler);
-
-        // fuel obtained upon launch and refuel
-        const int FUEL_MAX{100};
-
-        // current fuel level
-        int fuel{FUEL_MAX};
-        
-        // timespec structs hold time from clock_gettime()
-        // lastRefuelTime - launch time or refuel time
-        // lastNoticeTime - last time a notice of fuel level was printed
-        // now - current time; calculated for each loop
-        timespec lastRefuelTime, lastNoticeTime, now;
-
-        // measure current time as last refuel time
-        if (clock_gettime(CLOCK_REALTIME, &lastRefuelTime) == -1) {
-            perror("could not get time");
-            exit(EXIT_FAILURE);
-        }
-
-        // used to calculate current fuel units
-        double timeSinceRefuel;
-        
-        // used to ensure fuel notices are printed at least 9 seconds apart
-        double timeSinceNotice;
-
-        // initialize last notice time; allows for relational operator use
-        lastNoticeTime = lastRefuelTime;
-
-        // child process runs continuously until fuel reaches 0
-        while (fuel > 0) {
-
-            // sleep between loops (1ms)
-            usleep(1000);
-
-            // measure current time and calculate time since last refuel and notice
-            clock_gettime(CLOCK_REALTIME, &now);
-            timeSinceRefuel = getTimeDifference(lastRefuelTime, now);
-            timeSinceNotice = getTimeDifference(lastNoticeTime, now);
-
-            // plane uses 5 units of fuel per 3 seconds
-            fuel = FUEL_MAX - (static_cast<int>(timeSinceRefuel / 3) * 5);
 
-            // plane prints a notice of fuel level every 9 seconds if fuel
-            // level is below 50 units; don't print if fuel level is 0
-            if ((fuel < 50) && (timeSinceNotice > 9) && !(fuel <= 0)) {
+        // prompt the user for the next command
+        cout << "Command: " << flush;
+    }
 
-                // print notice
-                cout << "***Bomber " << getpid() << " to base, "
-                     << fuel << " fuel left***\nCommand: " << flush;
+    // once the parent exits the loop, terminate all children
+    closeChildren(fleet);
 
-                // record notice time
-                if (clock_gettime(CLOCK_REALTIME, &lastNoticeTime) == -1) {
-                    perror("could not get time");
-                    exit(EXIT_FAILURE);
-                }
-            }
-
-            // if the bomb flag is 1, drop a bomb and reset it to 0
-            if (bombFlag == 1) {
-                bombFlag = 0;
-                cout << "Bomber " << getpid() << " to base, bombs away!"
-                     << "\nCommand: " << flush;
-            }
-
-            // if refuel flag is 1, reset last refuel time, reset flag to 0,
-            // and set fuel value to max
-            if (refuelFlag == 1) {
-                
-                // reset fuel level to max and reset refuel flag
-                fuel = FUEL_MAX;
-                refuelFlag = 0;
-
-                // record refuel time
-                if (clock_gettime(CLOCK_REALTIME, &lastRefuelTime) == -1) {
-                    perror("could not get time");
-                    exit(EXIT_FAILURE);
-                }
-            }
-        }
-
-        // send SIGUSR2 to parent upon running out of fuel
-        kill(getppid(), SIGUSR2);
-    }
-    // one parent process exits while loop, terminate all children
-    else {
-        closeChildren(planesList);
-    }
+    close(epollFd);
+    close(signalFd);
 
     return 0;
 }
 
-int parseInput(commands& cmd, pid_t& id) {
-
-    // input from stdin is read into this string
-    string input;
-
-    // prompt the user for a command
-    cout << "Command: " << flush;
-
-    // read input from stdin into string input
-    getline(cin, input);
+int parseInput(const string& input, commands& cmd, pid_t& id, int& count) {
 
     // do nothing and return zero if the user would like to end the program
-    if (cin.eof()) {cout << endl; return 0; }
     if (input == "q") { return 0; }
 
+    // one plane is launched, or one bomb dropped, unless a count is given
+    count = 1;
+
     // test whether there is a space in the command; find() returns
     // `npos` if there are no matches; the if statement will catch the
     // commands `launch` and `status`
@@ -287,7 +410,8 @@ int parseInput(commands& cmd, pid_t& id) {
     }
     // if there is a <space> in the command, parse it for the command
     // part as well as the ID part for commands:
-    // `bomb <id number>` or `refuel <id number>`
+    // `bomb <id number> [count]` or `refuel <id number>`; for `l <count>`
+    // the number is the count of planes to launch
     else {
 
         // store the command part of a two-part command
@@ -302,32 +426,354 @@ int parseInput(commands& cmd, pid_t& id) {
         else if (cmdInput == "r") {
             cmd = REFUEL;
         }
+        else if (cmdInput == "l") {
+            cmd = LAUNCH;
+        }
         else {
             cmd = INVALID_CMD;
         }
 
-        // convert ID included with the command to an integer and store it
-        id = stoi(idInput, nullptr);
+        // convert the numbers included with the command to integers and
+        // store them; a command with a number that is not one is invalid
+        try {
+            size_t idLength;
+            int number = stoi(idInput, &idLength);
+
+            // the number of planes to launch
+            if (cmd == LAUNCH) {
+                count = number;
+            }
+            // the ID, and for a bomb command, the number of bombs if given
+            else {
+                id = number;
+
+                string countInput = idInput.substr(idLength);
+                if ((cmd == BOMB) && (countInput.find_first_not_of(" ") != string::npos)) {
+                    count = stoi(countInput, nullptr);
+                }
+            }
+        } catch (const std::logic_error&) {
+            cmd = INVALID_CMD;
+        }
+
+        // at least one plane has to be launched or bomb dropped, and a
+        // command can only carry a count up to COMMAND_COUNT_MAX
+        if ((count < 1) || (count > COMMAND_COUNT_MAX)) {
+            cmd = INVALID_CMD;
+        }
     }
 
     return 1;
 }
 
-void printStatus(const vector<pid_t> &listOfPlanes) {
+bool watchInput(int epollFd) {
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = STDIN_FILENO;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, STDIN_FILENO, &event) == 0) {
+        return true;
+    }
+
+    // epoll refuses regular files with EPERM
+    if (errno == EPERM) {
+        return false;
+    }
+
+    perror("could not watch user input");
+    exit(EXIT_FAILURE);
+}
+
+bool readInput(string& pendingInput) {
+
+    char buffer[4096];
+    ssize_t bytesRead = read(STDIN_FILENO, buffer, sizeof(buffer));
+
+    // nothing was read this time, but there may be more input later
+    if (bytesRead == -1) {
+        return true;
+    }
+
+    // a last line without a newline (e.g. at the end of a script) is
+    // still run; the next read returns EOF again
+    if ((bytesRead == 0) && !pendingInput.empty()) {
+        pendingInput.push_back('\n');
+        return true;
+    }
+
+    if (bytesRead == 0) {
+        return false;
+    }
+
+    pendingInput.append(buffer, bytesRead);
+    return true;
+}
+
+bool takeLine(string& pendingInput, string& line) {
+
+    string::size_type lineEnd = pendingInput.find('\n');
+    if (lineEnd == string::npos) {
+        return false;
+    }
+
+    line = pendingInput.substr(0, lineEnd);
+    pendingInput.erase(0, lineEnd + 1);
+    return true;
+}
+
+void printHelp(void) {
+    cout << "Commands:\n"
+         << "s\t= status: prints out the IDs of all live planes\n"
+         << "l [n]\t= launch: launches a new plane, or n new planes\n"
+         << "r <id>\t= refuel: refuels the plane with the specified ID\n"
+         << "b <id> [n]\t= bomb: drop a bomb, or n bombs, from the plane with the specified ID\n"
+         << "q\t= quit: quit the program\n";
+}
+
+int flySimulation(void) {
+
+    // the simulated planes; moving them forward is shared between one
+    // thread per hardware thread
+    PlaneSim sim{};
+
+    // a timer that goes off every tick of the simulation's timing wheel
+    int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+
+    // wait on the timer and user input at once
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if ((timerFd == -1) || (epollFd == -1)) {
+        perror("could not set up simulation");
+        exit(EXIT_FAILURE);
+    }
+
+    itimerspec timer{};
+    timer.it_value.tv_nsec = SIM_TICK_NANOSECONDS;
+    timer.it_interval.tv_nsec = SIM_TICK_NANOSECONDS;
+    if (timerfd_settime(timerFd, 0, &timer, nullptr) == -1) {
+        perror("could not set timer");
+        exit(EXIT_FAILURE);
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = timerFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &event) == -1) {
+        perror("could not set up simulation");
+        exit(EXIT_FAILURE);
+    }
+    bool inputWatched = watchInput(epollFd);
+
+    // holders for user's desired command and id after being parsed
+    commands command;
+    pid_t commandID;
+    int commandCount;
+
+    // the events of each move of the planes; kept between moves so their
+    // memory is reused
+    vector<SimNotice> notices{};
+    vector<uint32_t> crashes{};
+
+    // input read from stdin that does not yet make up a whole line
+    string pendingInput{};
+
+    // false once the user wants to quit (i.e. program receives `quit`
+    // or EOF from stdin)
+    bool running = true;
+
+    // prompt the user for the first command
+    cout << "Command: " << flush;
+
+    while (running) {
+
+        // sleep until there is user input or the timer goes off; if a whole
+        // line of input is already waiting, or stdin cannot be watched,
+        // only check the timer so the planes move between commands
+        bool lineWaiting = (pendingInput.find('\n') != string::npos);
+        int timeout = (lineWaiting || !inputWatched) ? 0 : -1;
+
+        epoll_event ready[2];
+        int readyCount = epoll_wait(epollFd, ready, 2, timeout);
+        if (readyCount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("could not wait for events");
+            exit(EXIT_FAILURE);
+        }
+
+        // stdin that cannot be watched is always ready to be read
+        bool inputReady = !inputWatched;
+
+        for (int i = 0; i < readyCount; i++) {
+
+            if (ready[i].data.fd == STDIN_FILENO) {
+                inputReady = true;
+                continue;
+            }
+
+            // move every plane up to now, and print what happened; the
+            // messages of one move share a single prompt
+            uint64_t expirations;
+            ssize_t bytesRead = read(timerFd, &expirations, sizeof(expirations));
+            (void)bytesRead;
+
+            sim.advance(monotonicNow(), notices, crashes);
+
+            for (const SimNotice& notice : notices) {
+                cout << "***Bomber " << notice.id << " to base, "
+                     << notice.fuel << " fuel left***\n";
+            }
+            for (uint32_t id : crashes) {
+                cout << "SOS! Plane " << id << " has crashed!\n";
+            }
+            if (!notices.empty() || !crashes.empty()) {
+                cout << "Command: " << flush;
+            }
+
+            notices.clear();
+            crashes.clear();
+        }
+
+        // read more input once every whole line read so far has been run;
+        // EOF ends the program
+        if (inputReady && !lineWaiting && !readInput(pendingInput)) {
+            cout << endl;
+            running = false;
+            continue;
+        }
+
+        // run a command for the next whole line of input, if there is one
+        string input;
+        if (!takeLine(pendingInput, input)) {
+            continue;
+        }
+
+        // do nothing more if the user would like to end the program
+        if (!parseInput(input, command, commandID, commandCount)) {
+            running = false;
+            continue;
+        }
+
+        switch (command) {
+
+            // print commands
+            case HELP:
+                printHelp();
+                break;
+
+            // print the number of planes, and their IDs if there
+            // are few enough
+            case STATUS:
+                printSimStatus(sim);
+                break;
+
+            // add `commandCount` planes to the simulation at once
+            case LAUNCH:
+                try {
+                    // the IDs are always printed, as the status command
+                    // stops listing planes once there are too many
+                    uint32_t firstId = sim.launch(monotonicNow(), commandCount);
+                    if (commandCount == 1) {
+                        cout << "Launched plane " << firstId << endl;
+                    } else {
+                        cout << "Launched planes " << firstId << " to "
+                             << firstId + (commandCount - 1) << endl;
+                    }
+                } catch (const std::overflow_error&) {
+                    cout << "There was a problem launching!" << endl;
+                }
+                break;
+
+            // fill the tank of the plane
+            case REFUEL:
+                if (!sim.refuel(commandID, monotonicNow())) {
+                    cout << "There is no plane with ID " << commandID << endl;
+                }
+                break;
+
+            // drop `commandCount` bombs from the plane
+            case BOMB:
+                if (sim.bomb(commandID)) {
+                    printBombs(commandID, commandCount);
+                    cout << endl;
+                } else {
+                    cout << "There is no plane with ID " << commandID << endl;
+                }
+                break;
+
+            // print a message if and invalid command is given
+            case INVALID_CMD:
+                cout << "Invalid command - type `help` for a list of commands."
+                     << endl;
+                break;
+
+            // should never happen, but if it does, it would be good to know
+            // that it happened
+            default:
+                cout << "If this line is printed, and error has occured."
+                     << endl;
+                break;
+        }
+
+        // prompt the user for the next command
+        cout << "Command: " << flush;
+    }
+
+    close(epollFd);
+    close(timerFd);
+
+    return 0;
+}
+
+void printSimStatus(const PlaneSim& sim) {
+
+    // if there are no planes, inform the user
+    if (sim.getPlaneCount() == 0) {
+
+        cout << "There are no planes in the sky!" << endl;
+
+    } else if (sim.getPlaneCount() > SIM_STATUS_MAX) {
+
+        cout << "There are " << sim.getPlaneCount() << " planes in the sky." << endl;
+
+    } else {
+
+        int64_t now = monotonicNow();
+
+        cout << "The current planes are: ";
+
+        // print each plane ID and its fuel level followed by a space
+        for (uint32_t id : sim.getIds()) {
+            cout << id << " (" << sim.getFuel(id, now) << " fuel) ";
+        }
+
+        // flush buffer and print newline char
+        cout << endl;
+    }
+}
+
+void printStatus(const unordered_map<pid_t, Plane>& fleet) {
 
     // if there are no child processes, inform the user
-    if (listOfPlanes.empty()) {
+    if (fleet.empty()) {
 
         cout << "There are no planes in the sky!" << endl;
-    
+
     } else {
 
+        // clock_gettime() on the monotonic clock is answered in user space
+        int64_t now = monotonicNow();
+
         cout << "The current planes are: ";
 
-        // print each child process ID followed by a space
-        for (int planeID : listOfPlanes) {
+        // print each child process ID and its seconds in the air followed
+        // by a space
+        for (const auto& entry : fleet) {
 
-            cout << planeID << " ";
+            const Plane& plane = entry.second;
+            cout << plane.id << " (" << (now - plane.launchTime) / NANOSECONDS_PER_SECOND
+                 << "s) ";
         }
 
         // flush buffer and print newline char
@@ -337,55 +783,238 @@ void printStatus(const vector<pid_t> &listOfPlanes) {
     return;
 }
 
-void removeDeadChildren(vector<pid_t>& children) {
+void reapChildren(unordered_map<pid_t, Plane>& fleet) {
+
+    // reap terminated children until none are left; waitpid() returns 0
+    // once the remaining children are all still running, and -1 once
+    // there are no children at all
+    pid_t childID;
+    while ((childID = waitpid(-1, nullptr, WNOHANG)) > 0) {
+
+        // erase the terminated child ID from the fleet
+        fleet.erase(childID);
+    }
+}
+
+void flyPlane(const sigset_t& planeSignals) {
+
+    // the signals from the parent are read from a file descriptor instead
+    // of interrupting the plane; reads return EAGAIN rather than wait once
+    // every signal has been read
+    int signalFd = signalfd(-1, &planeSignals, SFD_CLOEXEC | SFD_NONBLOCK);
 
-    // iterate over each plane (child process ID) in the planes list
-    for (auto idPtr = children.begin(); idPtr != children.end(); idPtr++) {
+    // a timer that goes off at the plane's next deadline
+    int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
 
-        // true if child process has terminated; otherwise, false
-        if (waitpid(*idPtr, NULL, WNOHANG)) {
+    // wait on both at once
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
 
-            // erase the terminated child ID from the planes list, and decrement the 
-            // iterator so the next value isn't skipped; this is because after
-            // deletion, the next value takes the position of the deleted value
-            children.erase(idPtr--);
+    if ((signalFd == -1) || (timerFd == -1) || (epollFd == -1)) {
+        perror("could not set up plane");
+        exit(EXIT_FAILURE);
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = signalFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, signalFd, &event) == -1) {
+        perror("could not set up plane");
+        exit(EXIT_FAILURE);
+    }
+    event.data.fd = timerFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &event) == -1) {
+        perror("could not set up plane");
+        exit(EXIT_FAILURE);
+    }
+
+    // lastRefuelTime - launch time or refuel time
+    // lastNoticeTime - last time a notice of fuel level was printed
+    int64_t lastRefuelTime = monotonicNow();
+    int64_t lastNoticeTime = lastRefuelTime;
+
+    // fuel is only checked at the plane's deadlines; the fuel level is
+    // worked out from the time since the last refuel when it is needed
+    while (true) {
+
+        // deadlines - the next notice is due once the fuel level is below
+        // LOW_FUEL and NOTICE_SECONDS have passed since the last notice; the
+        // plane crashes once it runs out of fuel
+        int64_t noticeTime = lastRefuelTime + (LOW_FUEL_SECONDS * NANOSECONDS_PER_SECOND);
+        if (noticeTime < lastNoticeTime + (NOTICE_SECONDS * NANOSECONDS_PER_SECOND)) {
+            noticeTime = lastNoticeTime + (NOTICE_SECONDS * NANOSECONDS_PER_SECOND);
+        }
+        int64_t crashTime = lastRefuelTime + (EMPTY_SECONDS * NANOSECONDS_PER_SECOND);
+
+        // set the timer to the earliest deadline
+        int64_t deadline = (noticeTime < crashTime) ? noticeTime : crashTime;
+        itimerspec timer{};
+        timer.it_value.tv_sec = deadline / NANOSECONDS_PER_SECOND;
+        timer.it_value.tv_nsec = deadline % NANOSECONDS_PER_SECOND;
+        if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &timer, nullptr) == -1) {
+            perror("could not set timer");
+            exit(EXIT_FAILURE);
+        }
+
+        // sleep until the timer goes off or a signal arrives
+        epoll_event ready[2];
+        int readyCount = epoll_wait(epollFd, ready, 2, -1);
+        if (readyCount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("could not wait for events");
+            exit(EXIT_FAILURE);
+        }
+
+        for (int i = 0; i < readyCount; i++) {
+
+            // a deadline has passed; the timer is read so it stops being
+            // ready, and the deadlines are checked below
+            if (ready[i].data.fd == timerFd) {
+                uint64_t expirations;
+                ssize_t bytesRead = read(timerFd, &expirations, sizeof(expirations));
+                (void)bytesRead;
+                continue;
+            }
+
+            // handle every signal the parent has sent; every command is
+            // queued as its own signal, so many signals are read at once
+            signalfd_siginfo infos[64];
+            ssize_t bytesRead;
+            while ((bytesRead = read(signalFd, infos, sizeof(infos))) > 0) {
+
+                for (size_t k = 0; k < bytesRead / sizeof(signalfd_siginfo); k++) {
+
+                    // the parent is closing every plane
+                    if (infos[k].ssi_signo == SIGTERM) {
+                        exit(EXIT_SUCCESS);
+                    }
+
+                    // the command and count the parent sent
+                    int command = infos[k].ssi_int & ((1 << COMMAND_BITS) - 1);
+                    int count = infos[k].ssi_int >> COMMAND_BITS;
+
+                    // drop the bombs
+                    if (command == BOMB_PLANE) {
+                        printBombs(getpid(), count);
+                        cout << "\nCommand: " << flush;
+                    }
+                    // reset the fuel level to max by recording the refuel time
+                    else if (command == REFUEL_PLANE) {
+                        lastRefuelTime = monotonicNow();
+                    }
+                }
+            }
+        }
+
+        int64_t now = monotonicNow();
+
+        // the plane has run out of fuel
+        if (now >= lastRefuelTime + (EMPTY_SECONDS * NANOSECONDS_PER_SECOND)) {
+            break;
+        }
+
+        // print a notice of the fuel level if one is due
+        if (now >= noticeTime) {
+
+            int fuel = fuelAfter(now - lastRefuelTime);
+
+            // a refuel may have arrived in the same wakeup as the deadline
+            if (fuel < LOW_FUEL) {
+                cout << "***Bomber " << getpid() << " to base, "
+                     << fuel << " fuel left***\nCommand: " << flush;
+                lastNoticeTime = now;
+            }
         }
     }
-}
 
-void refuelHandler(int signum) {
-    refuelFlag = 1;
-    return;
+    close(epollFd);
+    close(timerFd);
+    close(signalFd);
 }
 
-void bombHandler(int signum) {
-    bombFlag = 1;
-    return;
-}
+int64_t monotonicNow(void) {
 
-void childCrashHandler(int signum) {
-    cout << "SOS! Plane has crashed!\nCommand: " << flush;
-    return;
+    timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == -1) {
+        perror("could not get time");
+        exit(EXIT_FAILURE);
+    }
+
+    return (static_cast<int64_t>(now.tv_sec) * NANOSECONDS_PER_SECOND) + now.tv_nsec;
 }
 
-void childTerminateHandler(int signum) {
-    exit(EXIT_SUCCESS);
+bool sendCommand(pid_t plane, planeCommands command, int count) {
+
+    sigval value;
+    value.sival_int = (count << COMMAND_BITS) | command;
+
+    for (int attempt = 0; attempt < SEND_ATTEMPTS; attempt++) {
+
+        if (sigqueue(plane, COMMAND_SIGNAL, value) == 0) {
+            return true;
+        }
+
+        // EAGAIN means too many signals are waiting to be read; any other
+        // error means the plane cannot be reached at all
+        if (errno != EAGAIN) {
+            return false;
+        }
+
+        // give the planes a moment to read their signals
+        timespec pause{0, SEND_RETRY_NANOSECONDS};
+        nanosleep(&pause, nullptr);
+    }
+
+    return false;
 }
 
-double getTimeDifference(timespec& begin, timespec& end) {
+bool sendCrash(pid_t parent) {
 
-    // calculate and return the difference of end and beginning in seconds
-    return (end.tv_sec - begin.tv_sec) + ((end.tv_nsec - begin.tv_nsec) / 1e9);
+    for (int attempt = 0; attempt < SEND_ATTEMPTS; attempt++) {
+
+        // once the parent has died, the plane has been adopted by another
+        // process, which would be terminated by a CRASH_SIGNAL it does not
+        // expect; the check is made before every attempt, as the parent
+        // can die while the plane waits
+        if (getppid() != parent) {
+            return false;
+        }
+
+        if (kill(parent, CRASH_SIGNAL) == 0) {
+            return true;
+        }
+
+        // EAGAIN means too many signals are waiting to be read; any other
+        // error means the parent cannot be reached at all
+        if (errno != EAGAIN) {
+            return false;
+        }
+
+        // give the parent a moment to read its signals
+        timespec pause{0, SEND_RETRY_NANOSECONDS};
+        nanosleep(&pause, nullptr);
+    }
+
+    return false;
+}
+
+void printBombs(long id, int count) {
+    if (count == 1) {
+        cout << "Bomber " << id << " to base, bombs away!";
+    } else {
+        cout << "Bomber " << id << " to base, " << count << " bombs away!";
+    }
 }
 
-void closeChildren(const vector<pid_t>& children) {
+void closeChildren(const unordered_map<pid_t, Plane>& fleet) {
 
-    // iterate over each child process id
-    for (pid_t childProcessID : children) {
+    // iterate over each plane in the fleet
+    for (const auto& entry : fleet) {
 
         // send SIGTERM signal to child processes
-        kill(childProcessID, SIGTERM);
+        kill(entry.first, SIGTERM);
     }
-    
+
     return;
 }
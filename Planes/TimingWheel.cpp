@@ -0,0 +1,158 @@
+#include <stdexcept>
+
+#include "TimingWheel.h"
+
+// CONSTRUCTOR
+TimingWheel::TimingWheel(uint64_t startTick)
+        : nodes{}, freeList{WHEEL_NO_TIMER}, currentTick{startTick}, timerCount{0} {
+
+    // every bucket starts as a circle of just its head
+    nodes.resize(WHEEL_LEVELS * WHEEL_BUCKETS);
+    for (uint32_t head = 0; head < nodes.size(); head++) {
+        nodes[head] = WheelNode{0, 0, head, head};
+    }
+}
+
+uint32_t TimingWheel::schedule(uint64_t expiryTick, uint32_t payload) {
+
+    // a timer for a tick that has already passed goes off at the next one
+    if (expiryTick <= currentTick) {
+        expiryTick = currentTick + 1;
+    }
+
+    uint32_t timer = freeList;
+
+    // reuse a node from the free list if there is one; otherwise, add one
+    // to the end of the node array
+    if (timer != WHEEL_NO_TIMER) {
+        freeList = nodes[timer].next;
+    } else {
+
+        // the null handle cannot be used as the handle of a timer
+        if (nodes.size() == WHEEL_NO_TIMER) {
+            throw std::overflow_error{"TimingWheel timer count exceeded max"};
+        }
+
+        nodes.push_back(WheelNode{});
+        timer = static_cast<uint32_t>(nodes.size() - 1);
+    }
+
+    nodes[timer].expiryTick = expiryTick;
+    nodes[timer].payload = payload;
+    place(timer);
+    timerCount++;
+
+    return timer;
+}
+
+void TimingWheel::cancel(uint32_t timer) {
+
+    unlink(timer);
+
+    // push the node onto the front of the free list
+    nodes[timer].next = freeList;
+    freeList = timer;
+    timerCount--;
+}
+
+void TimingWheel::advance(uint64_t tick, std::vector<uint32_t>& expired) {
+
+    while (currentTick < tick) {
+
+        // with no timers left, there is nothing to go off on the ticks in
+        // between
+        if (timerCount == 0) {
+            currentTick = tick;
+            break;
+        }
+
+        currentTick++;
+
+        // at the start of each turn of a level, the bucket of the level
+        // above that the turn covers is emptied into the levels below;
+        // from the top down, so a timer can move down more than one level
+        for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+
+            int shift = level * WHEEL_BUCKET_BITS;
+            if ((currentTick & ((uint64_t{1} << shift) - 1)) != 0) {
+                continue;
+            }
+
+            // cut the timers out of the bucket, leaving it empty, then put
+            // each of them where its tick now belongs
+            uint32_t head = headOf(level, (currentTick >> shift) & (WHEEL_BUCKETS - 1));
+            uint32_t timer = nodes[head].next;
+            if (timer == head) {
+                continue;
+            }
+            nodes[nodes[head].prev].next = WHEEL_NO_TIMER;
+            nodes[head].prev = head;
+            nodes[head].next = head;
+
+            while (timer != WHEEL_NO_TIMER) {
+                uint32_t nextTimer = nodes[timer].next;
+                place(timer);
+                timer = nextTimer;
+            }
+        }
+
+        // every timer in the current bucket of level 0 goes off now, in the
+        // order they were put there
+        uint32_t head = headOf(0, currentTick & (WHEEL_BUCKETS - 1));
+        uint32_t timer = nodes[head].next;
+
+        while (timer != head) {
+
+            uint32_t nextTimer = nodes[timer].next;
+            expired.push_back(nodes[timer].payload);
+
+            nodes[timer].next = freeList;
+            freeList = timer;
+            timerCount--;
+
+            timer = nextTimer;
+        }
+
+        nodes[head].prev = head;
+        nodes[head].next = head;
+    }
+}
+
+void TimingWheel::place(uint32_t timer) {
+
+    uint64_t expiryTick = nodes[timer].expiryTick;
+    uint64_t ticksLeft = expiryTick - currentTick;
+
+    // the lowest level whose turn reaches the timer's tick; a bucket of
+    // that level is emptied into the levels below before the tick comes
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+
+        int shift = level * WHEEL_BUCKET_BITS;
+        if (ticksLeft < (uint64_t{1} << (shift + WHEEL_BUCKET_BITS))) {
+            linkBefore(headOf(level, (expiryTick >> shift) & (WHEEL_BUCKETS - 1)), timer);
+            return;
+        }
+    }
+
+    // a timer beyond the reach of the wheel waits in the last bucket the
+    // top level reaches, and is placed again when that bucket is emptied
+    int shift = (WHEEL_LEVELS - 1) * WHEEL_BUCKET_BITS;
+    uint64_t lastReached = currentTick + (uint64_t{1} << (shift + WHEEL_BUCKET_BITS)) - 1;
+    linkBefore(headOf(WHEEL_LEVELS - 1, (lastReached >> shift) & (WHEEL_BUCKETS - 1)), timer);
+}
+
+void TimingWheel::linkBefore(uint32_t head, uint32_t timer) {
+
+    // the bucket is a circle, so the node before the head is its last timer
+    nodes[timer].prev = nodes[head].prev;
+    nodes[timer].next = head;
+    nodes[nodes[head].prev].next = timer;
+    nodes[head].prev = timer;
+}
+
+void TimingWheel::unlink(uint32_t node) {
+
+    // join the nodes on either side of the one being removed
+    nodes[nodes[node].prev].next = nodes[node].next;
+    nodes[nodes[node].next].prev = nodes[node].prev;
+}
@@ -0,0 +1,101 @@
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// timer handle that does not refer to any timer
+const uint32_t WHEEL_NO_TIMER{UINT32_MAX};
+
+// the nodes of a Timing Wheel; a node is either a timer, linked into the
+// bucket for its tick, or the head of a bucket, which is linked into its
+// own bucket so that every bucket is a circle and a timer can be unlinked
+// without knowing which bucket it is in; free nodes are kept in a list
+// linked by `next`
+struct WheelNode {
+    uint64_t expiryTick;
+    uint32_t payload;
+    uint32_t prev;
+    uint32_t next;
+};
+
+// a Timing Wheel holds timers that go off at a whole tick, and hands back
+// every timer that has gone off in one batch per call to advance();
+// it is hierarchical: WHEEL_LEVELS wheels of WHEEL_BUCKETS buckets, where
+// a bucket of level 0 holds the timers of one tick and a bucket of level
+// `L` holds those of WHEEL_BUCKETS^L ticks; a timer is put in the lowest
+// level that reaches its tick, and is moved down a level each time the
+// wheel turns to its bucket, so scheduling and cancelling a timer are
+// O(1), and each timer is moved at most WHEEL_LEVELS - 1 times;
+// the timers live in one array and are linked by 32-bit indices, and a
+// timer's handle is its index, so it stays the same while it is moved
+// see: http://www.cs.columbia.edu/~nahum/w6998/papers/sosp87-timing-wheels.pdf
+class TimingWheel {
+
+public:
+
+    // number of levels and of buckets per level; the levels reach
+    // WHEEL_BUCKETS^WHEEL_LEVELS ticks ahead, and timers further away are
+    // kept in the last bucket that reaches and moved again later
+    static const int WHEEL_LEVELS{4};
+    static const int WHEEL_BUCKET_BITS{6};
+    static const int WHEEL_BUCKETS{1 << WHEEL_BUCKET_BITS};
+
+    // constructor method for a wheel with no timers at tick `startTick`
+    explicit TimingWheel(uint64_t startTick = 0);
+
+    // return the last tick the wheel has turned to
+    uint64_t getTick(void) const { return currentTick; };
+
+    // return the number of timers that have not gone off or been cancelled
+    std::size_t getTimerCount(void) const { return timerCount; };
+
+    // return the number of bytes of memory held by the node array
+    std::size_t getMemoryUsage(void) const { return nodes.capacity() * sizeof(WheelNode); };
+
+    // add a timer that goes off at `expiryTick`, or at the next tick if
+    // that has already passed; `payload` is handed back when it goes off;
+    // returns the timer's handle; O(1)
+    uint32_t schedule(uint64_t expiryTick, uint32_t payload);
+
+    // remove a timer that has not gone off; O(1)
+    void cancel(uint32_t timer);
+
+    // turn the wheel forward one tick at a time up to `tick`, adding the
+    // payload of every timer that goes off to the end of `expired`, in
+    // order of tick; a timer's handle may be reused once it has gone off;
+    // the wheel jumps straight to `tick` if it holds no timers
+    void advance(uint64_t tick, std::vector<uint32_t>& expired);
+
+private:
+
+    // return the node at the head of bucket `bucket` of level `level`
+    static uint32_t headOf(int level, uint64_t bucket) {
+        return static_cast<uint32_t>(level * WHEEL_BUCKETS + bucket);
+    };
+
+    // link the supplied timer into the bucket for its tick
+    void place(uint32_t timer);
+
+    // link the supplied timer before the head of a bucket
+    void linkBefore(uint32_t head, uint32_t timer);
+
+    // unlink the supplied node from its bucket
+    void unlink(uint32_t node);
+
+    // every node; the first WHEEL_LEVELS * WHEEL_BUCKETS are bucket heads
+    std::vector<WheelNode> nodes;
+
+    // the index of the first free node
+    uint32_t freeList;
+
+    // the last tick the wheel has turned to; every timer left in the wheel
+    // goes off after it
+    uint64_t currentTick;
+
+    // the number of timers in the wheel
+    std::size_t timerCount;
+};
+
+#endif
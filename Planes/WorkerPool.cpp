@@ -0,0 +1,118 @@
+#include "WorkerPool.h"
+
+// CONSTRUCTOR
+WorkerPool::WorkerPool(unsigned workerCount)
+        : workerCount{workerCount}, threads{}, mutex{}, batchReady{}, batchDone{},
+          work{nullptr}, batchSize{0}, batchWorkers{0}, batchNumber{0},
+          rangesLeft{0}, stopping{false} {
+
+    // use one worker per hardware thread if no count was given
+    if (this->workerCount == 0) {
+        this->workerCount = std::thread::hardware_concurrency();
+    }
+    if (this->workerCount == 0) {
+        this->workerCount = 1;
+    }
+
+    // the calling thread is worker 0, so one fewer thread is started
+    for (unsigned i = 1; i < this->workerCount; i++) {
+        threads.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+}
+
+// DESTRUCTOR
+WorkerPool::~WorkerPool() {
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+    batchReady.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::parallelFor(std::size_t n, const Work& work) {
+
+    // one worker for every MIN_RANGE items, up to the size of the pool
+    std::size_t workersWanted = n / MIN_RANGE;
+    if (workersWanted > workerCount) {
+        workersWanted = workerCount;
+    }
+
+    // if only one worker would be used, do the whole batch on the calling
+    // thread without waking any others
+    if (workersWanted < 2) {
+        if (n > 0) {
+            work(0, n, 0);
+        }
+        return;
+    }
+
+    // hand out the batch
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        this->work = &work;
+        batchSize = n;
+        batchWorkers = static_cast<unsigned>(workersWanted);
+        rangesLeft = batchWorkers;
+        batchNumber++;
+    }
+    batchReady.notify_all();
+
+    // the calling thread does the first range
+    runRange(0);
+
+    // wait until the other ranges are done
+    std::unique_lock<std::mutex> lock{mutex};
+    batchDone.wait(lock, [this] { return rangesLeft == 0; });
+    this->work = nullptr;
+}
+
+void WorkerPool::workerLoop(unsigned worker) {
+
+    // the last batch this thread has seen
+    uint64_t seenBatch = 0;
+
+    while (true) {
+
+        // sleep until there is a new batch, or the pool stops
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            batchReady.wait(lock, [this, seenBatch] {
+                return stopping || (batchNumber != seenBatch);
+            });
+
+            if (stopping) {
+                return;
+            }
+            seenBatch = batchNumber;
+
+            // this thread is not needed for a small batch
+            if (worker >= batchWorkers) {
+                continue;
+            }
+        }
+
+        runRange(worker);
+    }
+}
+
+void WorkerPool::runRange(unsigned worker) {
+
+    // worker `i` gets the i-th of `batchWorkers` nearly equal ranges; the
+    // batch cannot change until every range is done, so it is read
+    // without the lock
+    std::size_t begin = batchSize * worker / batchWorkers;
+    std::size_t end = batchSize * (worker + 1) / batchWorkers;
+    (*work)(begin, end, worker);
+
+    // the last worker to finish wakes the calling thread
+    std::lock_guard<std::mutex> lock{mutex};
+    rangesLeft--;
+    if (rangesLeft == 0) {
+        batchDone.notify_one();
+    }
+}
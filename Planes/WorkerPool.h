@@ -0,0 +1,90 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+// a Worker Pool keeps a few threads waiting for work, so a batch of work
+// can be split between them without starting a thread for every batch;
+// the thread that hands out a batch works on it too, and waits until
+// every part of it is done
+class WorkerPool {
+
+    // delete some special member functions so the compiler does not
+    // create default versions of them
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+
+public:
+
+    // a part of a batch: the range [begin, end) of the batch, and the
+    // number of the worker doing it (0 is the calling thread)
+    using Work = std::function<void(std::size_t begin, std::size_t end, unsigned worker)>;
+
+    // constructor method starts `workerCount - 1` threads, so the batch is
+    // shared between `workerCount` workers including the calling thread;
+    // uses one worker per hardware thread if no count is given
+    explicit WorkerPool(unsigned workerCount = 0);
+
+    // destructor method stops and joins the threads
+    ~WorkerPool();
+
+    // return the number of workers, including the calling thread
+    unsigned getWorkerCount(void) const { return workerCount; };
+
+    // split [0, n) into one contiguous range per worker and do `work` on
+    // every range at the same time; returns once every range is done;
+    // batches smaller than MIN_RANGE per worker use fewer workers
+    void parallelFor(std::size_t n, const Work& work);
+
+    // fewest items a worker is given; for smaller ranges, waking a thread
+    // costs more than it saves
+    static const std::size_t MIN_RANGE{16'384};
+
+private:
+
+    // waits for batches and does this thread's range of each one
+    void workerLoop(unsigned worker);
+
+    // do worker `worker`'s range of the current batch
+    void runRange(unsigned worker);
+
+    // number of workers including the calling thread
+    unsigned workerCount;
+
+    // the threads of the pool; worker `i` is threads[i - 1]
+    std::vector<std::thread> threads;
+
+    // guards everything below
+    std::mutex mutex;
+
+    // wakes the threads when a batch is handed out or the pool stops
+    std::condition_variable batchReady;
+
+    // wakes the calling thread when the last range of a batch is done
+    std::condition_variable batchDone;
+
+    // the current batch, its size and the number of workers sharing it
+    const Work* work;
+    std::size_t batchSize;
+    unsigned batchWorkers;
+
+    // counts the batches handed out, so a thread can tell a new batch
+    // from one it has already done
+    uint64_t batchNumber;
+
+    // ranges of the current batch still being worked on
+    unsigned rangesLeft;
+
+    // true once the pool is being destroyed
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,182 @@
+/*
+Times launching, flying and closing planes as child processes (one fork()
+each) against planes simulated by a PlaneSim inside one process, for
+fleets of 100 to 1M planes, and prints the results as a table.
+Usage: benchmark [--max-planes N]
+*/
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include "PlaneRules.h"
+#include "PlaneSim.h"
+
+// one timed operation on one fleet size
+struct Result {
+    std::string model;
+    std::string operation;
+    std::size_t planes;
+    double seconds;
+};
+
+// largest fleet launched as child processes; every plane is a process
+const std::size_t FORK_MAX_PLANES{1'000};
+
+// number of ticks flown before the planes are refuelled, none of which
+// has a deadline due, so that a refuel moves every timer
+const int REFUEL_AFTER_TICKS{50};
+
+// return the seconds since `start`
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// launch `n` planes as child processes that wait to be closed, then close
+// and reap all of them; the children only wait, so this times the cost of
+// the processes themselves rather than of flying them
+static void benchFork(std::size_t n, std::vector<Result>& results) {
+
+    std::vector<pid_t> children{};
+    children.reserve(n);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; i++) {
+
+        pid_t child = fork();
+        if (child < 0) {
+            perror("fork");
+            break;
+        }
+
+        // the child waits until SIGTERM ends it
+        if (child == 0) {
+            while (true) {
+                pause();
+            }
+        }
+
+        children.push_back(child);
+    }
+    results.push_back(Result{"fork", "launch", n, secondsSince(start)});
+
+    start = std::chrono::steady_clock::now();
+    for (pid_t child : children) {
+        kill(child, SIGTERM);
+    }
+    for (pid_t child : children) {
+        waitpid(child, nullptr, 0);
+    }
+    results.push_back(Result{"fork", "close", n, secondsSince(start)});
+}
+
+// launch `n` simulated planes at once, refuel each of them while they are
+// in flight, then fly them until every one has crashed
+static void benchSim(std::size_t n, std::vector<Result>& results) {
+
+    PlaneSim sim{};
+    std::vector<SimNotice> notices{};
+    std::vector<uint32_t> crashes{};
+
+    // the simulation runs on its own clock, one tick per move
+    int64_t now = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    sim.launch(now, n);
+    results.push_back(Result{"sim", "launch", n, secondsSince(start)});
+
+    // no timer goes off this early, so these ticks are not timed
+    for (int i = 0; i < REFUEL_AFTER_TICKS; i++) {
+        now += SIM_TICK_NANOSECONDS;
+        sim.advance(now, notices, crashes);
+    }
+
+    // refuel every plane, which moves its timer in the wheel
+    start = std::chrono::steady_clock::now();
+    for (uint32_t id = 1; id <= n; id++) {
+        sim.refuel(id, now);
+    }
+    results.push_back(Result{"sim", "refuel", n, secondsSince(start)});
+
+    // every plane sends its notices and crashes; the planes were refuelled
+    // together, so every deadline of every plane falls on the same few
+    // ticks, which are also timed on their own; the IDs are checked so the
+    // work cannot be skipped
+    std::size_t events = 0;
+    int dueTicks = 0;
+    double dueSeconds = 0;
+    start = std::chrono::steady_clock::now();
+    while (sim.getPlaneCount() > 0) {
+        now += SIM_TICK_NANOSECONDS;
+        auto tickStart = std::chrono::steady_clock::now();
+        sim.advance(now, notices, crashes);
+        if (!notices.empty() || !crashes.empty()) {
+            dueSeconds += secondsSince(tickStart);
+            dueTicks++;
+        }
+        events += notices.size() + crashes.size();
+        notices.clear();
+        crashes.clear();
+    }
+    results.push_back(Result{"sim", "fly until empty", n, secondsSince(start)});
+    results.push_back(Result{"sim", "move (due tick)", n, dueSeconds / dueTicks});
+
+    if (events < n) {
+        std::cerr << "simulation lost planes\n";
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void printTable(std::ostream& out, const std::vector<Result>& results) {
+
+    out << std::left << std::setw(8) << "model" << std::setw(18) << "operation"
+        << std::right << std::setw(10) << "planes" << std::setw(14) << "seconds"
+        << std::setw(16) << "ns per plane" << '\n';
+
+    for (const Result& r : results) {
+        out << std::left << std::setw(8) << r.model << std::setw(18) << r.operation
+            << std::right << std::setw(10) << r.planes
+            << std::setw(14) << std::fixed << std::setprecision(6) << r.seconds
+            << std::setw(16) << std::setprecision(1) << (r.seconds * 1e9 / r.planes)
+            << '\n';
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    std::size_t maxPlanes = 1'000'000;
+
+    for (int i = 1; i < argc; i++) {
+        if ((std::strcmp(argv[i], "--max-planes") == 0) && (i + 1 < argc)) {
+            maxPlanes = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--max-planes N]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Result> results{};
+
+    for (std::size_t n = 100; n <= maxPlanes; n *= 10) {
+        if (n <= FORK_MAX_PLANES) {
+            benchFork(n, results);
+        }
+        benchSim(n, results);
+    }
+
+    PlaneSim sizeCheck{1};
+    sizeCheck.launch(0, 1'000);
+    std::cout << "PlaneSim: " << sizeCheck.getMemoryUsage() / 1'000 << " bytes per plane, "
+              << PlaneSim{}.getWorkerCount() << " workers\n\n";
+
+    printTable(std::cout, results);
+
+    return 0;
+}